@@ -197,6 +197,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/EclipseState/Tables/BrineDensityTable.cpp
     opm/input/eclipse/EclipseState/Tables/SolventDensityTable.cpp
     opm/input/eclipse/EclipseState/Tables/Tabdims.cpp
+    opm/input/eclipse/Parser/DeckCache.cpp
     opm/input/eclipse/Parser/ErrorGuard.cpp
     opm/input/eclipse/Parser/InputErrorAction.cpp
     opm/input/eclipse/Parser/ParseContext.cpp
@@ -211,6 +212,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Python/Python.cpp
     opm/input/eclipse/Schedule/ArrayDimChecker.cpp
     opm/input/eclipse/Schedule/BCProp.cpp
+    opm/input/eclipse/Schedule/ChangeStamps.cpp
     opm/input/eclipse/Schedule/CompletedCells.cpp
     opm/input/eclipse/Schedule/eval_uda.cpp
     opm/input/eclipse/Schedule/Events.cpp
@@ -232,6 +234,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/ScheduleRestartInfo.cpp
     opm/input/eclipse/Schedule/ScheduleState.cpp
     opm/input/eclipse/Schedule/ScheduleStatic.cpp
+    opm/input/eclipse/Schedule/ScheduleStepIndex.cpp
     opm/input/eclipse/Schedule/ScheduleTypes.cpp
     opm/input/eclipse/Schedule/Source.cpp
     opm/input/eclipse/Schedule/SummaryState.cpp
@@ -294,6 +297,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/UDQ/UDQInput.cpp
     opm/input/eclipse/Schedule/UDQ/UDQParams.cpp
     opm/input/eclipse/Schedule/UDQ/UDQParser.cpp
+    opm/input/eclipse/Schedule/UDQ/UDQProgram.cpp
     opm/input/eclipse/Schedule/UDQ/UDQSet.cpp
     opm/input/eclipse/Schedule/UDQ/UDQState.cpp
     opm/input/eclipse/Schedule/UDQ/UDQToken.cpp
@@ -719,6 +723,7 @@ if(ENABLE_ECL_OUTPUT)
           tests/msim/MSIM_PYACTION_OPEN_WELL_AT_PAST_REPORT_STEP.DATA
           tests/msim/MSIM_PYACTION_OPEN_WELL_AT_TOO_LATE_REPORT_STEP.DATA
           tests/msim/MSIM_PYACTION_EXIT.DATA
+          tests/msim/MSIM_PYACTION_BATCH.DATA
           tests/msim/exit.py
           tests/msim/retrieve_info.py
           tests/msim/action1.py
@@ -732,6 +737,8 @@ if(ENABLE_ECL_OUTPUT)
           tests/msim/action_count_no_run_function.py
           tests/msim/open_well_past.py
           tests/msim/open_well_too_late.py
+          tests/msim/batch1.py
+          tests/msim/batch2.py
           tests/VFP_CASE.DATA)
 endif()
 
@@ -1133,6 +1140,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Units/UnitSystem.hpp
        opm/input/eclipse/Units/Units.hpp
        opm/input/eclipse/Units/Dimension.hpp
+       opm/input/eclipse/Parser/DeckCache.hpp
        opm/input/eclipse/Parser/ErrorGuard.hpp
        opm/input/eclipse/Parser/ParserItem.hpp
        opm/input/eclipse/Parser/Parser.hpp
@@ -1295,6 +1303,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/Action/WGNames.hpp
        opm/input/eclipse/Schedule/ArrayDimChecker.hpp
        opm/input/eclipse/Schedule/BCProp.hpp
+       opm/input/eclipse/Schedule/ChangeStamps.hpp
        opm/input/eclipse/Schedule/GasLiftOpt.hpp
        opm/input/eclipse/Schedule/Network/Balance.hpp
        opm/input/eclipse/Schedule/Network/Branch.hpp
@@ -1341,6 +1350,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/ScheduleRestartInfo.hpp
        opm/input/eclipse/Schedule/ScheduleState.hpp
        opm/input/eclipse/Schedule/ScheduleStatic.hpp
+       opm/input/eclipse/Schedule/ScheduleStepIndex.hpp
        opm/input/eclipse/Schedule/ScheduleTypes.hpp
        opm/input/eclipse/Schedule/Source.hpp
        opm/input/eclipse/Schedule/Tuning.hpp
@@ -1387,6 +1397,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp
        opm/input/eclipse/Schedule/UDQ/UDQInput.hpp
        opm/input/eclipse/Schedule/UDQ/UDQParams.hpp
+       opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp
        opm/input/eclipse/Schedule/UDQ/UDQSet.hpp
        opm/input/eclipse/Schedule/UDQ/UDQState.hpp
        opm/input/eclipse/Schedule/UDQ/UDQToken.hpp
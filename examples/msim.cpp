@@ -33,6 +33,8 @@
 
 #include <opm/msim/msim.hpp>
 
+#include <fmt/format.h>
+
 
 int main(int /* argc */, char** argv) {
     std::string deck_file = argv[1];
@@ -56,5 +58,16 @@ int main(int /* argc */, char** argv) {
     Opm::msim msim(state, schedule);
     Opm::EclipseIO io(state, state.getInputGrid(), schedule, summary_config);
     msim.run(io, false);
+
+    if (!msim.pyaction_time.empty()) {
+        double total = 0;
+        for (const auto& [report_step, seconds] : msim.pyaction_time) {
+            Opm::OpmLog::info(fmt::format("PYACTION report step {}: {:.3f} ms", report_step, 1000*seconds));
+            total += seconds;
+        }
+
+        Opm::OpmLog::info(fmt::format("PYACTION: {:.3f} ms per report step with PYACTION keywords",
+                                      1000*total / msim.pyaction_time.size()));
+    }
 }
 
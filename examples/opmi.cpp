@@ -34,6 +34,7 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/OpmLog/StreamLog.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
+#include <opm/common/TimingMacros.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 
@@ -53,26 +54,29 @@ inline void loadDeck( const char * deck_file) {
     Opm::time_point start;
 
     start = Opm::TimeService::now();
-    auto deck = parser.parseFile(deck_file, parseContext, errors);
+    auto deck = [&]() { OPM_TIMEBLOCK(parseDeck); return parser.parseFile(deck_file, parseContext, errors); }();
     auto deck_time = Opm::TimeService::now() - start;
 
     std::cout << "parse complete - creating EclipseState .... ";  std::cout.flush();
 
     start = Opm::TimeService::now();
-    Opm::EclipseState state( deck );
+    const auto state = [&]() { OPM_TIMEBLOCK(createEclipseState); return Opm::EclipseState( deck ); }();
     auto state_time = Opm::TimeService::now() - start;
 
     std::cout << "creating Schedule .... ";  std::cout.flush();
 
     start = Opm::TimeService::now();
-    Opm::Schedule schedule( deck, state, python);
+    const auto schedule = [&]() { OPM_TIMEBLOCK(createSchedule); return Opm::Schedule( deck, state, python); }();
     auto schedule_time = Opm::TimeService::now() - start;
 
     std::cout << "creating SummaryConfig .... ";  std::cout.flush();
 
     start = Opm::TimeService::now();
-    Opm::SummaryConfig summary( deck, schedule, state.fieldProps(), state.aquifer(),
-                                parseContext, errors );
+    const auto summary = [&]() {
+        OPM_TIMEBLOCK(createSummaryConfig);
+        return Opm::SummaryConfig( deck, schedule, state.fieldProps(), state.aquifer(),
+                                   parseContext, errors );
+    }();
     auto summary_time = Opm::TimeService::now() - start;
 
     std::cout << "complete." << std::endl << std::endl;
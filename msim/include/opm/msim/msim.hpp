@@ -13,6 +13,7 @@
 #include <opm/input/eclipse/Deck/UDAValue.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <string>
@@ -73,6 +74,10 @@ public:
     Schedule schedule;
     Action::State action_state;
     SummaryState st;
+
+    // Wall clock time, in seconds, spent running PYACTION keywords at each
+    // report step.
+    std::map<std::size_t, double> pyaction_time;
 };
 
 } // namespace Opm
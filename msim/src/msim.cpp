@@ -141,10 +141,17 @@ void msim::post_step(data::Solution& /* sol */,
         }
     }
 
-    for (const auto& pyaction : actions.pending_python(this->action_state)) {
-        this->schedule.runPyAction(report_step, *pyaction,
-                                   this->action_state, this->state, this->st);
+    const auto pyactions = actions.pending_python(this->action_state);
+    if (pyactions.empty()) {
+        return;
     }
+
+    const auto start = std::chrono::steady_clock::now();
+    this->schedule.runPyActions(report_step, pyactions,
+                                this->action_state, this->state, this->st);
+
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+    this->pyaction_time[report_step] += elapsed.count();
 }
 
 
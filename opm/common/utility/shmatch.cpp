@@ -21,6 +21,8 @@
 
 #include <opm/common/utility/shmatch.hpp>
 
+#include <string_view>
+
 #if HAVE_FNMATCH_H
 #include <fnmatch.h>
 #else
@@ -55,3 +57,56 @@ bool Opm::shmatch(const std::string& pattern, const std::string& symbol)
 #endif
 }
 
+
+Opm::ShellPattern::ShellPattern(const std::string& pattern)
+    : m_pattern(pattern)
+{
+    if (pattern.find_first_of("?[\\") != std::string::npos)
+        return;
+
+    std::string::size_type start = 0;
+    while (true) {
+        const auto star = pattern.find('*', start);
+        this->m_segments.push_back(pattern.substr(start, star - start));
+        if (star == std::string::npos)
+            break;
+
+        start = star + 1;
+    }
+    this->m_compiled = true;
+}
+
+bool Opm::ShellPattern::match(const std::string& symbol) const
+{
+    if (!this->m_compiled)
+        return shmatch(this->m_pattern, symbol);
+
+    if (this->m_segments.size() == 1)
+        return symbol == this->m_segments.front();
+
+    // The first segment must be a prefix and the last segment a suffix of
+    // the symbol; the segments in between must appear in order in the
+    // remaining part. Matching each of them at its leftmost position is
+    // sufficient when '*' is the only wildcard.
+    const auto& first = this->m_segments.front();
+    const auto& last = this->m_segments.back();
+    if (symbol.size() < first.size() + last.size())
+        return false;
+
+    std::string_view sym { symbol };
+    if ((sym.substr(0, first.size()) != first) ||
+        (sym.substr(sym.size() - last.size()) != last))
+        return false;
+
+    sym = sym.substr(first.size(), sym.size() - first.size() - last.size());
+    for (std::size_t s = 1; s + 1 < this->m_segments.size(); ++s) {
+        const auto& segment = this->m_segments[s];
+        const auto pos = sym.find(segment);
+        if (pos == std::string_view::npos)
+            return false;
+
+        sym.remove_prefix(pos + segment.size());
+    }
+
+    return true;
+}
@@ -21,6 +21,7 @@
 #define OPM_UTILITY_SHMATCH_HPP
 
 #include <string>
+#include <vector>
 
 namespace Opm {
 
@@ -32,6 +33,26 @@ namespace Opm {
 
 bool shmatch(const std::string& pattern, const std::string& symbol);
 
+/*
+  The ShellPattern class is a precompiled shell pattern for matching the
+  same pattern against many symbols. Patterns where '*' is the only special
+  character - i.e. the typical well and group name templates like 'P*' or
+  'OP_*_B' - are split into literal segments once, and matched with plain
+  string comparisons. All other patterns are passed on to shmatch().
+*/
+
+class ShellPattern {
+public:
+    explicit ShellPattern(const std::string& pattern);
+
+    bool match(const std::string& symbol) const;
+    const std::string& pattern() const { return this->m_pattern; }
+
+private:
+    std::string m_pattern;
+    std::vector<std::string> m_segments;
+    bool m_compiled = false;
+};
 
 }
 #endif //OPM_UTILITY_STRING_HPP
@@ -222,6 +222,7 @@ const DeckView& Deck::global_view() const {
         defaultUnits = data.defaultUnits;
         m_dataFile = data.m_dataFile;
         input_path = data.input_path;
+        file_tree = data.file_tree;
         unit_system_access_count = data.unit_system_access_count;
         activeUnits = data.activeUnits;
 
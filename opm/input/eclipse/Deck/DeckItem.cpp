@@ -257,6 +257,25 @@ void DeckItem::push_back( UDAValue x, size_t n ) {
     this->push( std::move( x ), n );
 }
 
+template< typename T >
+void DeckItem::push( std::vector< T >&& data ) {
+    auto& val = this->value_ref< T >();
+
+    this->value_status.insert( this->value_status.end(), data.size(), value::status::deck_value );
+    if (val.empty())
+        val = std::move( data );
+    else
+        val.insert( val.end(), data.begin(), data.end() );
+}
+
+void DeckItem::push_back( std::vector<int>&& data ) {
+    this->push( std::move( data ) );
+}
+
+void DeckItem::push_back( std::vector<double>&& data ) {
+    this->push( std::move( data ) );
+}
+
 template< typename T >
 void DeckItem::push_default( T x, std::size_t n ) {
     auto& val = this->value_ref< T >();
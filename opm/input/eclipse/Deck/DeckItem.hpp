@@ -90,6 +90,10 @@ namespace Opm {
         void push_back( int, size_t );
         void push_back( double, size_t );
         void push_back( std::string, size_t );
+        // Append a complete vector of values; the storage is taken over
+        // as-is if the item is empty.
+        void push_back( std::vector<int>&& );
+        void push_back( std::vector<double>&& );
         void push_backDefault( UDAValue, std::size_t n = 1 );
         void push_backDefault( int, std::size_t n = 1 );
         void push_backDefault( double, std::size_t n = 1 );
@@ -175,6 +179,7 @@ namespace Opm {
         template< typename T > const std::vector< T >& value_ref() const;
         template< typename T > void push( T );
         template< typename T > void push( T, size_t );
+        template< typename T > void push( std::vector< T >&& );
         template< typename T > void push_default( T, std::size_t n );
         template< typename T > void write_vector(DeckOutput& writer, const std::vector<T>& data) const;
     };
@@ -28,9 +28,15 @@
 
 #include <algorithm>
 #include <ostream>
+#include <utility>
 
 namespace Opm {
 
+    struct DeckKeyword::Pending {
+        ParseFunction parse;
+        std::shared_ptr<const DeckKeyword> result;
+    };
+
     DeckKeyword::DeckKeyword(const ParserKeyword& parserKeyword) :
         m_keywordName(parserKeyword.getName()),
         m_isDataKeyword(false),
@@ -52,6 +58,38 @@ namespace Opm {
     {
     }
 
+    DeckKeyword::DeckKeyword(const KeywordLocation& location, const std::string& keywordName, ParseFunction parse) :
+        DeckKeyword(location, keywordName)
+    {
+        this->m_pending = std::make_shared<Pending>();
+        this->m_pending->parse = std::move(parse);
+    }
+
+    bool DeckKeyword::isParsed() const {
+        return !this->m_pending;
+    }
+
+    void DeckKeyword::materialize() const {
+        if (!this->m_pending)
+            return;
+
+        // If the parse function throws the keyword stays pending, and the
+        // same error is raised again on the next access.
+        auto& pending = *this->m_pending;
+        if (!pending.result) {
+            pending.result = std::make_shared<const DeckKeyword>(pending.parse());
+            pending.parse = nullptr;
+        }
+
+        auto* self = const_cast<DeckKeyword*>(this);
+        const auto& result = *pending.result;
+        self->m_recordList = result.m_recordList;
+        self->m_isDataKeyword = result.m_isDataKeyword;
+        self->m_slashTerminated = result.m_slashTerminated;
+        self->m_isDoubleRecordKeyword = result.m_isDoubleRecordKeyword;
+        self->m_pending.reset();
+    }
+
     DeckKeyword DeckKeyword::serializationTestObject()
     {
         DeckKeyword result;
@@ -155,6 +193,12 @@ namespace Opm {
     }
 
     DeckKeyword::DeckKeyword(const ParserKeyword& parserKeyword, const std::vector<int>& data) :
+        DeckKeyword(parserKeyword, std::vector<int>(data))
+    {
+    }
+
+
+    DeckKeyword::DeckKeyword(const ParserKeyword& parserKeyword, std::vector<int>&& data) :
         DeckKeyword(parserKeyword)
     {
         if (!parserKeyword.isDataKeyword())
@@ -168,7 +212,7 @@ namespace Opm {
             throw std::invalid_argument("Input to DeckKeyword '" + name() + "': cannot be std::vector<int>.");
 
         DeckItem item(parser_item.name(), int() );
-        std::for_each(data.begin(), data.end(), [&item](const int val) { item.push_back(val); });
+        item.push_back( std::move(data) );
 
         DeckRecord deck_record;
         deck_record.addItem( std::move(item) );
@@ -177,6 +221,12 @@ namespace Opm {
 
 
     DeckKeyword::DeckKeyword(const ParserKeyword& parserKeyword, const std::vector<double>& data, const UnitSystem& system_active, const UnitSystem& system_default) :
+        DeckKeyword(parserKeyword, std::vector<double>(data), system_active, system_default)
+    {
+    }
+
+
+    DeckKeyword::DeckKeyword(const ParserKeyword& parserKeyword, std::vector<double>&& data, const UnitSystem& system_active, const UnitSystem& system_default) :
         DeckKeyword(parserKeyword)
     {
         if (!parserKeyword.isDataKeyword())
@@ -197,7 +247,7 @@ namespace Opm {
              default_dimensions.push_back( system_default.parse(dim[0]) );
         }
         DeckItem item(parser_item.name(), double(), active_dimensions, default_dimensions);
-        std::for_each(data.begin(), data.end(), [&item](const double val) { item.push_back(val); });
+        item.push_back( std::move(data) );
 
         DeckRecord deck_record;
         deck_record.addItem( std::move(item) );
@@ -206,6 +256,7 @@ namespace Opm {
 
 
     void DeckKeyword::setFixedSize() {
+        this->materialize();
         m_slashTerminated = false;
     }
 
@@ -215,18 +266,22 @@ namespace Opm {
     }
 
     void DeckKeyword::setDataKeyword(bool isDataKeyword_) {
+        this->materialize();
         m_isDataKeyword = isDataKeyword_;
     }
 
    void DeckKeyword::setDoubleRecordKeyword(bool isDoubleRecordKeyword) {
+        this->materialize();
         m_isDoubleRecordKeyword = isDoubleRecordKeyword;
    }
 
     bool DeckKeyword::isDataKeyword() const {
+        this->materialize();
         return m_isDataKeyword;
     }
 
     bool DeckKeyword::isDoubleRecordKeyword() const {
+        this->materialize();
         return m_isDoubleRecordKeyword;
     }
 
@@ -235,30 +290,37 @@ namespace Opm {
     }
 
     size_t DeckKeyword::size() const {
+        this->materialize();
         return m_recordList.size();
     }
 
     bool DeckKeyword::empty() const {
+        this->materialize();
         return this->m_recordList.empty();
     }
 
     void DeckKeyword::addRecord(DeckRecord&& record) {
+        this->materialize();
         this->m_recordList.push_back( std::move( record ) );
     }
 
     DeckKeyword::const_iterator DeckKeyword::begin() const {
+        this->materialize();
         return m_recordList.begin();
     }
 
     DeckKeyword::const_iterator DeckKeyword::end() const {
+        this->materialize();
         return m_recordList.end();
     }
 
     const DeckRecord& DeckKeyword::operator[](std::size_t index) const {
+        this->materialize();
         return this->m_recordList.at( index );
     }
 
     DeckRecord& DeckKeyword::operator[](std::size_t index) {
+        this->materialize();
         return this->m_recordList.at( index );
     }
 
@@ -271,6 +333,7 @@ namespace Opm {
     }
 
     const DeckRecord& DeckKeyword::getDataRecord() const {
+        this->materialize();
         if (m_recordList.size() == 1)
             return getRecord(0);
         else
@@ -321,6 +384,7 @@ namespace Opm {
     }
 
     void DeckKeyword::write( DeckOutput& output ) const {
+        this->materialize();
         if (this->name() == "TITLE")
             this->write_TITLE( output );
         else {
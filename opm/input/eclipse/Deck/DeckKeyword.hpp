@@ -20,6 +20,8 @@
 #ifndef DECKKEYWORD_HPP
 #define DECKKEYWORD_HPP
 
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -38,13 +40,24 @@ namespace Opm {
 
 
         typedef std::vector< DeckRecord >::const_iterator const_iterator;
+        using ParseFunction = std::function<DeckKeyword()>;
 
         DeckKeyword();
         explicit DeckKeyword(const ParserKeyword& parserKeyword);
         DeckKeyword(const KeywordLocation& location, const std::string& keywordName);
         DeckKeyword(const ParserKeyword& parserKeyword, const std::vector<std::vector<DeckValue>>& record_list, const UnitSystem& system_active, const UnitSystem& system_default);
         DeckKeyword(const ParserKeyword& parserKeyword, const std::vector<int>& data);
+        DeckKeyword(const ParserKeyword& parserKeyword, std::vector<int>&& data);
         DeckKeyword(const ParserKeyword& parserKeyword, const std::vector<double>& data, const UnitSystem& system_active, const UnitSystem& system_default);
+        DeckKeyword(const ParserKeyword& parserKeyword, std::vector<double>&& data, const UnitSystem& system_active, const UnitSystem& system_default);
+
+        /// A keyword which has been located in the input, but whose
+        /// records are only parsed, with the supplied function, the first
+        /// time they are accessed. Copies of the keyword share the parse
+        /// result. Materialization mutates the keyword and is not thread
+        /// safe.
+        DeckKeyword(const KeywordLocation& location, const std::string& keywordName, ParseFunction parse);
+        bool isParsed() const;
 
         static DeckKeyword serializationTestObject();
 
@@ -96,6 +109,7 @@ namespace Opm {
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
+            this->materialize();
             serializer(m_keywordName);
             serializer(m_location);
             serializer(m_recordList);
@@ -105,6 +119,9 @@ namespace Opm {
         }
 
     private:
+        struct Pending;
+        void materialize() const;
+
         std::string m_keywordName;
         KeywordLocation m_location;
 
@@ -112,6 +129,8 @@ namespace Opm {
         bool m_isDataKeyword;
         bool m_slashTerminated;
         bool m_isDoubleRecordKeyword = false;
+
+        mutable std::shared_ptr<Pending> m_pending;
     };
 }
 
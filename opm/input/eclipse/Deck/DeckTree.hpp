@@ -47,9 +47,17 @@ public:
     bool has_include(const std::string& fname) const;
     const std::string& root() const;
 
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(root_file);
+        serializer(nodes);
+    }
+
 private:
     class TreeNode {
     public:
+        TreeNode() = default;
         explicit TreeNode(const std::string& fn);
         TreeNode(const std::string& pn, const std::string& fn);
         void add_include(const std::string& include_file);
@@ -58,6 +66,14 @@ private:
         std::string fname;
         std::optional<std::string> parent;
         std::unordered_set<std::string> include_files;
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(fname);
+            serializer(parent);
+            serializer(include_files);
+        }
     };
 
     std::string add_node(const std::string& fname);
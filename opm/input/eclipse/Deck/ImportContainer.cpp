@@ -18,8 +18,12 @@
 
 #include <opm/input/eclipse/Deck/ImportContainer.hpp>
 
+#include <exception>
 #include <stdexcept>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -28,11 +32,53 @@
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/input/eclipse/Parser/Parser.hpp>
 
+namespace {
+
+/*
+  The EclFile class only hands out const references to the arrays it has
+  loaded; the IMPORT keywords take over the storage instead.
+*/
+class ImportFile : public Opm::EclIO::EclFile {
+public:
+    ImportFile(const std::string& fname, bool formatted_input)
+        : Opm::EclIO::EclFile(fname, Formatted{formatted_input})
+    {}
+
+    std::vector<int> releaseInt(int arrIndex) { return release(this->inte_array, arrIndex); }
+    std::vector<float> releaseReal(int arrIndex) { return release(this->real_array, arrIndex); }
+    std::vector<double> releaseDouble(int arrIndex) { return release(this->doub_array, arrIndex); }
+
+private:
+    // Does not modify the map itself, so distinct arrays can be released
+    // concurrently.
+    template <typename T>
+    static std::vector<T> release(std::unordered_map<int, std::vector<T>>& arrays, int arrIndex)
+    {
+        auto iter = arrays.find(arrIndex);
+        if (iter == arrays.end())
+            throw std::logic_error(fmt::format("IMPORT array {} has not been loaded", arrIndex));
+
+        return std::move(iter->second);
+    }
+};
+
+struct ImportArray {
+    int index;
+    const Opm::ParserKeyword* parser_kw;
+    Opm::EclIO::eclArrType data_type;
+    std::vector<int> int_data;
+    std::vector<double> double_data;
+};
+
+}
+
 namespace Opm {
 
 ImportContainer::ImportContainer(const Parser& parser, const UnitSystem& unit_system, const std::string& fname, bool formatted, std::size_t deck_size) {
-    EclIO::EclFile ecl_file(fname, EclIO::EclFile::Formatted{formatted});
+    ImportFile ecl_file(fname, formatted);
     const auto& header = ecl_file.getList();
+
+    std::vector<ImportArray> arrays;
     for (std::size_t kw_index = 0; kw_index < header.size(); kw_index++) {
         const auto& [name, data_type, _] = header[kw_index];
         (void)_;
@@ -49,22 +95,60 @@ ImportContainer::ImportContainer(const Parser& parser, const UnitSystem& unit_sy
 
         const auto& parser_item = parser_kw.getRecord(0).get(0);
         if (parser_item.dataType() == type_tag::fdouble) {
-            if (data_type == EclIO::REAL) {
-                auto& float_data = ecl_file.get<float>(kw_index);
-                std::vector<double> double_data{ float_data.begin(), float_data.end() };
-                this->keywords.emplace_back(parser_kw, double_data, unit_system, unit_system);
-            } else if (data_type == EclIO::DOUB) {
-                auto& double_data = ecl_file.get<double>(kw_index);
-                this->keywords.emplace_back(parser_kw, double_data, unit_system, unit_system);
-            }
+            if ((data_type != EclIO::REAL) && (data_type != EclIO::DOUB))
+                continue;
         } else if (parser_item.dataType() == type_tag::integer) {
-            const auto& data = ecl_file.get<int>(kw_index);
-            this->keywords.emplace_back(parser_kw, data);
+            if (data_type != EclIO::INTE)
+                throw std::logic_error(fmt::format("File: {} keyword:{}\nInteger keyword is not stored as integer data in IMPORT file", fname, name));
         } else
             throw std::logic_error(fmt::format("File: {} keyword:{}\nIMPORT keyword only supports integer and floating point data keywords", fname, name));
 
+        arrays.push_back({ static_cast<int>(kw_index), &parser_kw, data_type, {}, {} });
+    }
+
+    // Read all the arrays in one pass over the file ...
+    {
+        std::vector<int> indices;
+        for (const auto& array : arrays)
+            indices.push_back(array.index);
+        ecl_file.loadData(indices);
+    }
+
+    // ... and convert them concurrently. The integer and double precision
+    // arrays are moved, only single precision data is copied. Exceptions
+    // must not escape the parallel region; the first one is rethrown.
+    std::vector<std::exception_ptr> errors(arrays.size());
+#pragma omp parallel for schedule(dynamic)
+    for (std::size_t array_index = 0; array_index < arrays.size(); array_index++) {
+        auto& array = arrays[array_index];
+        try {
+            if (array.data_type == EclIO::REAL) {
+                const auto float_data = ecl_file.releaseReal(array.index);
+                array.double_data.assign(float_data.begin(), float_data.end());
+            } else if (array.data_type == EclIO::DOUB)
+                array.double_data = ecl_file.releaseDouble(array.index);
+            else
+                array.int_data = ecl_file.releaseInt(array.index);
+        } catch (...) {
+            errors[array_index] = std::current_exception();
+        }
+    }
+
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    this->keywords.reserve(arrays.size());
+    for (auto& array : arrays) {
+        const auto& parser_kw = *array.parser_kw;
+        if (parser_kw.getRecord(0).get(0).dataType() == type_tag::fdouble)
+            this->keywords.emplace_back(parser_kw, std::move(array.double_data), unit_system, unit_system);
+        else
+            this->keywords.emplace_back(parser_kw, std::move(array.int_data));
+
         deck_size += 1;
-        auto msg = fmt::format("{:5} Loading {:<8} from IMPORT file {}", deck_size, name, fname);
+        auto msg = fmt::format("{:5} Loading {:<8} from IMPORT file {}", deck_size, parser_kw.getName(), fname);
         OpmLog::info(msg);
     }
 }
@@ -314,9 +314,7 @@ namespace Opm {
     }
 
     void EclipseState::appendInputNNC(const std::vector<NNCdata>& nnc) {
-        for (const auto& nnc_data : nnc ) {
-            this->m_inputNnc.addNNC(nnc_data.cell1, nnc_data.cell2, nnc_data.trans);
-        }
+        this->m_inputNnc.merge(nnc);
     }
 
     bool EclipseState::hasInputNNC() const {
@@ -25,6 +25,7 @@
 #include <opm/input/eclipse/Deck/DeckItem.hpp>
 #include <opm/input/eclipse/Deck/DeckRecord.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 #include <utility>
 
@@ -167,11 +168,11 @@ namespace Opm
         return m_dims[idim];
     }
 
-    const std::vector<Box::cell_index>& Box::index_list() const {
+    const Box::IndexList& Box::index_list() const {
         return this->m_active_index_list;
     }
 
-    const std::vector<Box::cell_index>& Box::global_index_list() const {
+    const Box::IndexList& Box::global_index_list() const {
         return this->m_global_index_list;
     }
 
@@ -180,25 +181,150 @@ namespace Opm
         this->m_active_index_list.clear();
         this->m_global_index_list.clear();
 
-        const auto boxdims = GridDims(this->m_dims[0], this->m_dims[1], this->m_dims[2]);
-        const auto ncells = boxdims.getCartesianSize();
+        const auto nx = this->m_dims[0];
+        auto data_index = std::size_t{0};
+
+        // Every row of the box is one run of consecutive global indices,
+        // the active cells are split into runs at the inactive cells.
+        for (std::size_t k = 0; k < this->m_dims[2]; ++k) {
+            for (std::size_t j = 0; j < this->m_dims[1]; ++j) {
+                const auto row_start = this->m_globalGridDims_
+                    .getGlobalIndex(this->m_offset[0],
+                                    j + this->m_offset[1],
+                                    k + this->m_offset[2]);
+
+                this->m_global_index_list.push_back(cell_range { row_start, row_start, data_index, nx });
+
+                for (std::size_t i = 0; i < nx; ++i) {
+                    const auto global_index = row_start + i;
+                    if (this->m_globalIsActive_(global_index)) {
+                        const auto active_index = this->m_globalActiveIdx_(global_index);
+                        this->m_active_index_list.push_back(cell_index { global_index, active_index, data_index + i });
+                    }
+                }
+
+                data_index += nx;
+            }
+        }
+    }
 
-        for (auto data_index = 0*ncells; data_index != ncells; ++data_index) {
-            const auto boxIJK = boxdims.getIJK(data_index);
-            const auto global_index = this->m_globalGridDims_
-                .getGlobalIndex(boxIJK[0] + this->m_offset[0],
-                                boxIJK[1] + this->m_offset[1],
-                                boxIJK[2] + this->m_offset[2]);
+    // ------------------------------------------------------------------------
 
-            if (this->m_globalIsActive_(global_index)) {
-                const auto active_index = this->m_globalActiveIdx_(global_index);
-                this->m_active_index_list.emplace_back(global_index, active_index, data_index);
+    void Box::IndexList::push_back(const cell_index& cell)
+    {
+        this->push_back(cell_range { cell.global_index, cell.active_index, cell.data_index, 1 });
+    }
+
+    void Box::IndexList::push_back(const cell_range& range)
+    {
+        if (range.size == 0)
+            return;
+
+        if (! this->m_ranges.empty()) {
+            auto& last = this->m_ranges.back();
+            if ((last.global_index + last.size == range.global_index) &&
+                (last.active_index + last.size == range.active_index) &&
+                (last.data_index   + last.size == range.data_index))
+            {
+                last.size += range.size;
+                this->m_size += range.size;
+                return;
             }
+        }
+
+        this->m_ranges.push_back(range);
+        this->m_start.push_back(this->m_size);
+        this->m_size += range.size;
+    }
+
+    void Box::IndexList::clear()
+    {
+        this->m_ranges.clear();
+        this->m_start.clear();
+        this->m_size = 0;
+    }
 
-            this->m_global_index_list.emplace_back(global_index, data_index);
+    std::size_t Box::IndexList::size() const
+    {
+        return this->m_size;
+    }
+
+    bool Box::IndexList::empty() const
+    {
+        return this->m_size == 0;
+    }
+
+    const std::vector<Box::cell_range>& Box::IndexList::ranges() const
+    {
+        return this->m_ranges;
+    }
+
+    Box::cell_index Box::IndexList::operator[](const std::size_t index) const
+    {
+        if (index >= this->m_size) {
+            throw std::out_of_range {
+                fmt::format("Cell {} is outside index list of size {}", index, this->m_size)
+            };
         }
+
+        const auto pos = std::upper_bound(this->m_start.begin(), this->m_start.end(), index)
+            - this->m_start.begin() - 1;
+        const auto& range = this->m_ranges[pos];
+        const auto offset = index - this->m_start[pos];
+
+        return { range.global_index + offset,
+                 range.active_index + offset,
+                 range.data_index   + offset };
     }
 
+    Box::IndexList::const_iterator Box::IndexList::begin() const
+    {
+        return { &this->m_ranges, 0, 0 };
+    }
+
+    Box::IndexList::const_iterator Box::IndexList::end() const
+    {
+        return { &this->m_ranges, this->m_ranges.size(), 0 };
+    }
+
+    Box::cell_index Box::IndexList::const_iterator::operator*() const
+    {
+        const auto& range = (*this->m_ranges)[this->m_range];
+        return { range.global_index + this->m_offset,
+                 range.active_index + this->m_offset,
+                 range.data_index   + this->m_offset };
+    }
+
+    Box::IndexList::const_iterator& Box::IndexList::const_iterator::operator++()
+    {
+        if (++this->m_offset == (*this->m_ranges)[this->m_range].size) {
+            ++this->m_range;
+            this->m_offset = 0;
+        }
+
+        return *this;
+    }
+
+    Box::IndexList::const_iterator Box::IndexList::const_iterator::operator++(int)
+    {
+        auto prev = *this;
+        ++(*this);
+        return prev;
+    }
+
+    bool Box::IndexList::const_iterator::operator==(const const_iterator& other) const
+    {
+        return (this->m_range == other.m_range)
+            && (this->m_offset == other.m_offset);
+    }
+
+    bool Box::IndexList::const_iterator::operator!=(const const_iterator& other) const
+    {
+        return ! (*this == other);
+    }
+
+    // ------------------------------------------------------------------------
+
     bool Box::operator==(const Box& other) const
     {
         return (this->m_dims == other.m_dims)
@@ -25,6 +25,7 @@
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <vector>
 
 namespace Opm {
@@ -63,6 +64,73 @@ namespace Opm
             {}
         };
 
+        // A run of cells where the global, active and data indices all
+        // increase by one from cell to cell.
+        struct cell_range
+        {
+            std::size_t global_index;
+            std::size_t active_index;
+            std::size_t data_index;
+            std::size_t size;
+        };
+
+        // List of cells stored as runs of consecutive cells.  A box
+        // covering whole rows of the grid, with all cells active, is a
+        // single run irrespective of the number of cells.  Consumers
+        // should loop over the ranges(); the cell-by-cell iteration and
+        // indexing is for convenience only.
+        class IndexList
+        {
+        public:
+            class const_iterator
+            {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = cell_index;
+                using difference_type = std::ptrdiff_t;
+                using pointer = void;
+                using reference = cell_index;
+
+                const_iterator(const std::vector<cell_range>* ranges,
+                               std::size_t range, std::size_t offset)
+                    : m_ranges(ranges), m_range(range), m_offset(offset)
+                {}
+
+                cell_index operator*() const;
+                const_iterator& operator++();
+                const_iterator operator++(int);
+                bool operator==(const const_iterator& other) const;
+                bool operator!=(const const_iterator& other) const;
+
+            private:
+                const std::vector<cell_range>* m_ranges;
+                std::size_t m_range;
+                std::size_t m_offset;
+            };
+
+            // Append a cell, extending the last run if possible.
+            void push_back(const cell_index& cell);
+            void clear();
+
+            std::size_t size() const;
+            bool empty() const;
+            const std::vector<cell_range>& ranges() const;
+
+            cell_index operator[](std::size_t index) const;
+            const_iterator begin() const;
+            const_iterator end() const;
+
+        private:
+            std::vector<cell_range> m_ranges;
+
+            // Number of cells before each run; used for indexing.
+            std::vector<std::size_t> m_start;
+            std::size_t m_size = 0;
+
+            void push_back(const cell_range& range);
+            friend class Box;
+        };
+
         explicit Box(const GridDims& gridDims,
                      IsActive        isActive,
                      ActiveIdx       activeIdx);
@@ -81,8 +149,8 @@ namespace Opm
         std::size_t size() const;
         std::size_t getDim(std::size_t idim) const;
 
-        const std::vector<cell_index>& index_list() const;
-        const std::vector<cell_index>& global_index_list() const;
+        const IndexList& index_list() const;
+        const IndexList& global_index_list() const;
 
         bool operator==(const Box& other) const;
         bool equal(const Box& other) const;
@@ -102,8 +170,8 @@ namespace Opm
         std::array<std::size_t, 3> m_dims{};
         std::array<std::size_t, 3> m_offset{};
 
-        std::vector<cell_index> m_active_index_list;
-        std::vector<cell_index> m_global_index_list;
+        IndexList m_active_index_list;
+        IndexList m_global_index_list;
 
         void init(int i1, int i2, int j1, int j2, int k1, int k2);
         void initIndexList();
@@ -79,7 +79,7 @@ namespace Opm {
         this->m_keywordBox.reset();
     }
 
-    const std::vector<Box::cell_index>& BoxManager::index_list() const
+    const Box::IndexList& BoxManager::index_list() const
     {
         return this->getActiveBox().index_list();
     }
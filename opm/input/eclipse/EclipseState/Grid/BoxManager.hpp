@@ -66,7 +66,7 @@ namespace Opm {
         void endKeyword();
 
         const Box& getActiveBox() const;
-        const std::vector<Box::cell_index>& index_list() const;
+        const Box::IndexList& index_list() const;
 
     private:
         GridDims gridDims_{};
@@ -23,6 +23,7 @@
 #include <opm/input/eclipse/EclipseState/Grid/FieldProps.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/TimingMacros.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/utility/numeric/calculateCellVol.hpp>
 #include <opm/common/utility/numeric/VectorOps.hpp>
@@ -83,6 +84,32 @@ std::optional<UnitSystem> make_grid_units(const std::string& grid_unit) {
     return std::nullopt;
 }
 
+std::array<double, 3> cellDims(const std::array<double, 8>& X,
+                               const std::array<double, 8>& Y,
+                               const std::array<double, 8>& Z)
+{
+    // calculate dx
+    double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
+    double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
+    double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
+    double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
+    double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
+
+    // calculate dy
+    x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
+    y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
+    x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
+    y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
+    double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
+
+    // calculate dz
+    double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+    double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+    double dz = z2-z1;
+
+    return std::array<double,3> {{dx, dy, dz}};
+}
+
 void apply_GRIDUNIT(const UnitSystem& deck_units, const UnitSystem& grid_units, std::vector<double>& data)
 {
     double scale_factor = grid_units.getDimension(UnitSystem::measure::length).getSIScaling() / deck_units.getDimension(UnitSystem::measure::length).getSIScaling();
@@ -145,6 +172,7 @@ EclipseGrid::EclipseGrid(const GridDims& gd)
 {
     this->m_nactive = this->getCartesianSize();
     this->active_volume = std::nullopt;
+    this->active_depth = std::nullopt;
     // Nothing else initialized. Leaving in particular as empty:
     // m_actnum,
     // m_global_to_active,
@@ -336,6 +364,7 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
 
     void EclipseGrid::initGrid(const Deck& deck, const int* actnum)
     {
+        OPM_TIMEFUNCTION();
         enum GridType { COORD, DEPTHZ, TOPS, RADIAL, SPIDER, GDFILE, GT_SIZE };
 
         std::vector<int> found;
@@ -382,23 +411,26 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
             throw std::invalid_argument(message);
         }
 
-        switch (found.front()) {
-        case GridType::COORD:
-            this->initCornerPointGrid(deck);
-            break;
-        case GridType::DEPTHZ:
-        case GridType::TOPS:
-            this->initCartesianGrid(deck);
-            break;
-        case GridType::RADIAL:
-            this->initCylindricalGrid(deck);
-            break;
-        case GridType::SPIDER:
-            this->initSpiderwebGrid(deck);
-            break;
-        case GridType::GDFILE:
-            this->initBinaryGrid(deck);
-            break;
+        {
+            OPM_TIMEBLOCK(initGridGeometry);
+            switch (found.front()) {
+            case GridType::COORD:
+                this->initCornerPointGrid(deck);
+                break;
+            case GridType::DEPTHZ:
+            case GridType::TOPS:
+                this->initCartesianGrid(deck);
+                break;
+            case GridType::RADIAL:
+                this->initCylindricalGrid(deck);
+                break;
+            case GridType::SPIDER:
+                this->initSpiderwebGrid(deck);
+                break;
+            case GridType::GDFILE:
+                this->initBinaryGrid(deck);
+                break;
+            }
         }
 
         if (deck.hasKeyword<ParserKeywords::PINCH>()) {
@@ -435,6 +467,7 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
             this->resetACTNUM(actnum);
         }
         else if (! this->m_useActnumFromGdfile) {
+            OPM_TIMEBLOCK(initGridActnum);
             const auto fp = FieldProps {
                 deck, EclipseGrid { static_cast<GridDims&>(*this) }
             };
@@ -1539,32 +1572,140 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         return m_minpvMode == MinpvMode::Inactive || cell_porv >= m_minpvVector[globalIndex];
     }
 
-    const std::vector<double>& EclipseGrid::activeVolume() const {
-        if (!this->active_volume.has_value()) {
-            std::vector<double> volume(this->m_nactive);
-
-            #pragma omp parallel for schedule(static)
-            for (std::size_t active_index = 0; active_index < this->m_active_to_global.size(); active_index++) {
-                std::array<double,8> X;
-                std::array<double,8> Y;
-                std::array<double,8> Z;
-                auto global_index = this->m_active_to_global[active_index];
-                this->getCellCorners(global_index, X, Y, Z );
-                if (m_rv && m_thetav) {
-                    const auto[i,j,k] = this->getIJK(global_index);
-                    const auto& r = *m_rv;
-                    const auto& t = *m_thetav;
-                    volume[active_index] = calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
-                } else
-                    volume[active_index] = calculateCellVol(X, Y, Z);
+    /*
+      Visit the corners of all active cells, one column of cells at a time.
+      The interpolation along the four pillars of a column is set up once,
+      and the inner loop over the layers only reads ZCORN.  The arithmetic
+      is the same as in getCellCorners().
+    */
+    template <typename CellFunction>
+    void EclipseGrid::visitActiveCellCorners(CellFunction&& cell_function) const {
+        const std::size_t nx = this->getNX();
+        const std::size_t ny = this->getNY();
+        const std::size_t nz = this->getNZ();
+        const std::size_t layer_size = nx * ny;
+
+        #pragma omp parallel for schedule(static)
+        for (std::size_t column = 0; column < layer_size; column++) {
+            const std::size_t i = column % nx;
+            const std::size_t j = column / nx;
+
+            std::array<std::size_t, 4> pind;
+            pind[0] = j*(nx+1)*6 + i*6;
+            pind[1] = pind[0] + 6;
+            pind[2] = pind[0] + (nx+1)*6;
+            pind[3] = pind[2] + 6;
+
+            std::array<double, 4> xt, yt, zt, slope_x, slope_y;
+            std::array<bool, 4> vertical;
+            for (int n = 0; n < 4; n++) {
+                xt[n] = m_coord[pind[n]];
+                yt[n] = m_coord[pind[n] + 1];
+                zt[n] = m_coord[pind[n] + 2];
+
+                const double zb = m_coord[pind[n] + 5];
+                vertical[n] = (zt[n] == zb);
+                if (!vertical[n]) {
+                    slope_x[n] = (m_coord[pind[n] + 3] - xt[n]) / (zt[n] - zb);
+                    slope_y[n] = (m_coord[pind[n] + 4] - yt[n]) / (zt[n] - zb);
+                }
             }
 
-            this->active_volume = std::move(volume);
+            std::array<double, 8> X, Y, Z;
+            for (std::size_t k = 0; k < nz; k++) {
+                const std::size_t global_index = column + k*layer_size;
+                const int active_index = this->m_global_to_active[global_index];
+                if (active_index < 0)
+                    continue;
+
+                const std::size_t z_offset = k*layer_size*8 + j*nx*4 + i*2;
+                const std::array<std::size_t, 4> zind = {
+                    z_offset, z_offset + 1, z_offset + nx*2, z_offset + nx*2 + 1
+                };
+                for (int n = 0; n < 4; n++) {
+                    Z[n] = m_zcorn[zind[n]];
+                    Z[n + 4] = m_zcorn[zind[n] + layer_size*4];
+                }
+
+                for (int n = 0; n < 4; n++) {
+                    if (vertical[n]) {
+                        X[n] = X[n + 4] = xt[n];
+                        Y[n] = Y[n + 4] = yt[n];
+                    } else {
+                        X[n] = xt[n] + slope_x[n] * (zt[n] - Z[n]);
+                        X[n + 4] = xt[n] + slope_x[n] * (zt[n] - Z[n + 4]);
+                        Y[n] = yt[n] + slope_y[n] * (zt[n] - Z[n]);
+                        Y[n + 4] = yt[n] + slope_y[n] * (zt[n] - Z[n + 4]);
+                    }
+                }
+
+                cell_function(static_cast<std::size_t>(active_index), i, j, X, Y, Z);
+            }
+        }
+    }
+
+    void EclipseGrid::computeActiveGeometry() const {
+        std::vector<double> volume(this->m_nactive);
+        std::vector<double> depth(this->m_nactive);
+
+        this->visitActiveCellCorners([this, &volume, &depth](const std::size_t active_index,
+                                                             const std::size_t i,
+                                                             const std::size_t j,
+                                                             const std::array<double, 8>& X,
+                                                             const std::array<double, 8>& Y,
+                                                             const std::array<double, 8>& Z)
+        {
+            if (m_rv && m_thetav) {
+                const auto& r = *m_rv;
+                const auto& t = *m_thetav;
+                volume[active_index] = calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
+            } else
+                volume[active_index] = calculateCellVol(X, Y, Z);
+
+            const double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+            const double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+            depth[active_index] = (z1 + z2)/2.0;
+        });
+
+        for (const auto& [global_index, aquifer_depth] : this->m_aquifer_cell_depths) {
+            if (this->cellActive(global_index))
+                depth[this->activeIndex(global_index)] = aquifer_depth;
         }
 
+        this->active_volume = std::move(volume);
+        this->active_depth = std::move(depth);
+    }
+
+    const std::vector<double>& EclipseGrid::activeVolume() const {
+        if (!this->active_volume.has_value())
+            this->computeActiveGeometry();
+
         return this->active_volume.value();
     }
 
+    const std::vector<double>& EclipseGrid::activeDepth() const {
+        if (!this->active_depth.has_value())
+            this->computeActiveGeometry();
+
+        return this->active_depth.value();
+    }
+
+    std::vector<std::array<double, 3>> EclipseGrid::activeCellDims() const {
+        std::vector<std::array<double, 3>> dims(this->m_nactive);
+
+        this->visitActiveCellCorners([&dims](const std::size_t active_index,
+                                             const std::size_t,
+                                             const std::size_t,
+                                             const std::array<double, 8>& X,
+                                             const std::array<double, 8>& Y,
+                                             const std::array<double, 8>& Z)
+        {
+            dims[active_index] = cellDims(X, Y, Z);
+        });
+
+        return dims;
+    }
+
 
     double EclipseGrid::getCellVolume(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
@@ -1623,28 +1764,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
 
-        // calculate dx
-        double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
-        double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
-        double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
-        double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
-        double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
-
-        // calculate dy
-        x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
-        y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
-        x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
-        y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
-        double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
-
-        // calculate dz
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        double dz = z2-z1;
-
-
-        return std::array<double,3> {{dx, dy, dz}};
+        return cellDims(X, Y, Z);
     }
 
     std::array<double, 3> EclipseGrid::getCellDims(size_t i , size_t j , size_t k) const {
@@ -1804,6 +1924,8 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
     double EclipseGrid::getCellDepth(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        if (this->active_depth.has_value() && this->cellActive(globalIndex))
+            return this->active_depth.value()[this->activeIndex(globalIndex)];
 
         auto it = this->m_aquifer_cell_depths.find(globalIndex);
         return it != this->m_aquifer_cell_depths.end() ? it->second : computeCellGeometricDepth(globalIndex);
@@ -1859,32 +1981,20 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
         const std::array<int, 3> dims = getNXYZ();
 
-        // Preparing vectors to be saved
-
-        // create coord vector of floats with input units, converted from SI
-        std::vector<float> coord_f;
-        coord_f.resize(m_coord.size());
-
-        auto convert_length = [&units](const double x) { return static_cast<float>(units.from_si(length, x)); };
+        // COORD and ZCORN are written as floats in input units, converted
+        // from SI one block at a time while writing.
+        const auto& coord = m_input_coord.has_value() ? m_input_coord.value() : m_coord;
+        const auto& zcorn = m_input_zcorn.has_value() ? m_input_zcorn.value() : m_zcorn;
 
-        if (m_input_coord.has_value()) {
-            std::transform(m_input_coord.value().begin(), m_input_coord.value().end(), coord_f.begin(), convert_length);
-        } else {
-            std::transform(m_coord.begin(), m_coord.end(), coord_f.begin(), convert_length);
-        }
-
-        // create zcorn vector of floats with input units, converted from SI
-        std::vector<float> zcorn_f;
-        zcorn_f.resize(m_zcorn.size());
-
-        if (m_input_zcorn.has_value()) {
-            std::transform(m_input_zcorn.value().begin(), m_input_zcorn.value().end(), zcorn_f.begin(), convert_length);
-        } else {
-            std::transform(m_zcorn.begin(), m_zcorn.end(), zcorn_f.begin(), convert_length);
-        }
+        auto convert_length = [&units](const std::vector<double>& source)
+        {
+            return [&units, &source](const std::size_t offset, std::vector<float>& block)
+            {
+                std::transform(source.begin() + offset, source.begin() + offset + block.size(), block.begin(),
+                               [&units](const double x) { return static_cast<float>(units.from_si(length, x)); });
+            };
+        };
 
-        m_input_coord.reset();
-        m_input_zcorn.reset();
 
         std::vector<int> filehead(100,0);
         filehead[0] = 3;                     // version number
@@ -1899,15 +2009,16 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         gridhead[24] = 1;                   // corner point grid
 
         std::vector<int> nnchead(10, 0);
-        std::vector<int> nnc1;
-        std::vector<int> nnc2;
-
-        for (const NNCdata& n : nnc ) {
-            nnc1.push_back(n.cell1 + 1);
-            nnc2.push_back(n.cell2 + 1);
-        }
+        nnchead[0] = nnc.size();
 
-        nnchead[0] = nnc1.size();
+        auto nnc_cell = [&nnc](std::size_t NNCdata::* cell)
+        {
+            return [&nnc, cell](const std::size_t offset, std::vector<int>& block)
+            {
+                std::transform(nnc.begin() + offset, nnc.begin() + offset + block.size(), block.begin(),
+                               [cell](const NNCdata& n) { return static_cast<int>(n.*cell + 1); });
+            };
+        };
 
         std::vector<std::string> gridunits;
 
@@ -1945,16 +2056,19 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         egridfile.write("GRIDUNIT", gridunits);
         egridfile.write("GRIDHEAD", gridhead);
 
-        egridfile.write("COORD", coord_f);
-        egridfile.write("ZCORN", zcorn_f);
+        egridfile.write<float>("COORD", coord.size(), convert_length(coord));
+        egridfile.write<float>("ZCORN", zcorn.size(), convert_length(zcorn));
+
+        m_input_coord.reset();
+        m_input_zcorn.reset();
 
         egridfile.write("ACTNUM", m_actnum);
         egridfile.write("ENDGRID", endgrid);
 
-        if (nnc1.size() > 0){
+        if (!nnc.empty()){
             egridfile.write("NNCHEAD", nnchead);
-            egridfile.write("NNC1", nnc1);
-            egridfile.write("NNC2", nnc2);
+            egridfile.write<int>("NNC1", nnc.size(), nnc_cell(&NNCdata::cell1));
+            egridfile.write<int>("NNC2", nnc.size(), nnc_cell(&NNCdata::cell2));
         }
     }
 
@@ -1972,34 +2086,35 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         std::iota(this->m_global_to_active.begin(), this->m_global_to_active.end(), 0);
         this->m_active_to_global = this->m_global_to_active;
         this->active_volume = std::nullopt;
+        this->active_depth = std::nullopt;
     }
 
     void EclipseGrid::resetACTNUM(const int* actnum) {
         if (actnum == nullptr)
             this->resetACTNUM();
         else {
-            auto global_size = this->getCartesianSize();
-            this->m_global_to_active.clear();
+            OPM_TIMEBLOCK(resetACTNUM);
+            const auto global_size = this->getCartesianSize();
+            this->m_actnum.assign(actnum, actnum + global_size);
+
+            // numerical aquifer cells need to be active
+            for (const auto& aquifer_cell : this->m_aquifer_cells)
+                this->m_actnum[aquifer_cell] = 1;
+
+            this->m_global_to_active.resize(global_size);
             this->m_active_to_global.clear();
-            this->m_actnum.resize(global_size);
             this->m_nactive = 0;
-
             for (size_t n = 0; n < global_size; n++) {
-                this->m_actnum[n] = actnum[n];
-                // numerical aquifer cells need to be active
-                if (this->m_aquifer_cells.count(n) > 0) {
-                    this->m_actnum[n] = 1;
-                }
                 if (this->m_actnum[n] > 0) {
-                    this->m_global_to_active.push_back(this->m_nactive);
+                    this->m_global_to_active[n] = this->m_nactive;
                     this->m_active_to_global.push_back(n);
                     this->m_nactive++;
                 } else {
-                    this->m_global_to_active.push_back(-1);
-
+                    this->m_global_to_active[n] = -1;
                 }
             }
             this->active_volume = std::nullopt;
+            this->active_depth = std::nullopt;
         }
     }
 
@@ -2037,8 +2152,10 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
                 const size_t global_index = this->getGlobalIndex(i, j, k);
                 this->m_aquifer_cells.insert(global_index);
 
-                if (! record.getItem<AQUNUM::DEPTH>().defaultApplied(0))
+                if (! record.getItem<AQUNUM::DEPTH>().defaultApplied(0)) {
                     this->m_aquifer_cell_depths.insert_or_assign(global_index, record.getItem<AQUNUM::DEPTH>().getSIDouble(0));
+                    this->active_depth = std::nullopt;
+                }
 
                 // Create map global_index -> (PVTNUM, SATNUM) to allow QC during FieldProps creation
                 const int pvtnum = record.getItem<AQUNUM::PVT_TABLE_NUM>().defaultApplied(0) ? 0 : record.getItem<AQUNUM::PVT_TABLE_NUM>().get<int>(0);
@@ -2086,63 +2203,86 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         return index(i,j,k,c);
     }
 
+    /*
+      The ZCORN checks only compare values along the same pillar corner,
+      i.e. every (i,j) column can be processed independently.  The columns
+      are distributed over threads, and within a column the layers are
+      visited in the same order as a serial sweep, so the result does not
+      depend on the number of threads.
+    */
     bool ZcornMapper::validZCORN( const std::vector<double>& zcorn) const {
-        int sign = zcorn[ this->index(0,0,0,0) ] <= zcorn[this->index(0,0, this->dims[2] - 1,4)] ? 1 : -1;
-        for (size_t j=0; j < this->dims[1]; j++)
-            for (size_t i=0; i < this->dims[0]; i++)
-                for (size_t c=0; c < 4; c++)
-                    for (size_t k=0; k < this->dims[2]; k++) {
-                        /* Between cells */
-                        if (k > 0) {
-                            size_t index1 = this->index(i,j,k-1,c+4);
-                            size_t index2 = this->index(i,j,k,c);
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0)
-                                return false;
+        OPM_TIMEFUNCTION();
+        const int sign = zcorn[ this->index(0,0,0,0) ] <= zcorn[this->index(0,0, this->dims[2] - 1,4)] ? 1 : -1;
+        const std::size_t num_columns = this->dims[0] * this->dims[1];
+        bool valid = true;
+
+        #pragma omp parallel for schedule(static) reduction(&&:valid)
+        for (std::size_t column = 0; column < num_columns; column++) {
+            const std::size_t i = column % this->dims[0];
+            const std::size_t j = column / this->dims[0];
+            for (size_t c=0; c < 4 && valid; c++)
+                for (size_t k=0; k < this->dims[2]; k++) {
+                    /* Between cells */
+                    if (k > 0) {
+                        size_t index1 = this->index(i,j,k-1,c+4);
+                        size_t index2 = this->index(i,j,k,c);
+                        if ((zcorn[index2] - zcorn[index1]) * sign < 0) {
+                            valid = false;
+                            break;
                         }
+                    }
 
-                        /* In cell */
-                        {
-                            size_t index1 = this->index(i,j,k,c);
-                            size_t index2 = this->index(i,j,k,c+4);
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0)
-                                return false;
+                    /* In cell */
+                    {
+                        size_t index1 = this->index(i,j,k,c);
+                        size_t index2 = this->index(i,j,k,c+4);
+                        if ((zcorn[index2] - zcorn[index1]) * sign < 0) {
+                            valid = false;
+                            break;
                         }
                     }
+                }
+        }
 
-        return true;
+        return valid;
     }
 
 
     size_t ZcornMapper::fixupZCORN( std::vector<double>& zcorn) {
-        int sign = zcorn[ this->index(0,0,0,0) ] <= zcorn[this->index(0,0, this->dims[2] - 1,4)] ? 1 : -1;
+        OPM_TIMEFUNCTION();
+        const int sign = zcorn[ this->index(0,0,0,0) ] <= zcorn[this->index(0,0, this->dims[2] - 1,4)] ? 1 : -1;
+        const std::size_t num_columns = this->dims[0] * this->dims[1];
         size_t cells_adjusted = 0;
 
-        for (size_t k=0; k < this->dims[2]; k++)
-            for (size_t j=0; j < this->dims[1]; j++)
-                for (size_t i=0; i < this->dims[0]; i++)
-                    for (size_t c=0; c < 4; c++) {
-                        /* Cell to cell */
-                        if (k > 0) {
-                            size_t index1 = this->index(i,j,k-1,c+4);
-                            size_t index2 = this->index(i,j,k,c);
-
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
-                                zcorn[index2] = zcorn[index1];
-                                cells_adjusted++;
-                            }
+        #pragma omp parallel for schedule(static) reduction(+:cells_adjusted)
+        for (std::size_t column = 0; column < num_columns; column++) {
+            const std::size_t i = column % this->dims[0];
+            const std::size_t j = column / this->dims[0];
+            for (size_t c=0; c < 4; c++)
+                for (size_t k=0; k < this->dims[2]; k++) {
+                    /* Cell to cell */
+                    if (k > 0) {
+                        size_t index1 = this->index(i,j,k-1,c+4);
+                        size_t index2 = this->index(i,j,k,c);
+
+                        if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
+                            zcorn[index2] = zcorn[index1];
+                            cells_adjusted++;
                         }
+                    }
 
-                        /* Cell internal */
-                        {
-                            size_t index1 = this->index(i,j,k,c);
-                            size_t index2 = this->index(i,j,k,c+4);
+                    /* Cell internal */
+                    {
+                        size_t index1 = this->index(i,j,k,c);
+                        size_t index2 = this->index(i,j,k,c+4);
 
-                            if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
-                                zcorn[index2] = zcorn[index1];
-                                cells_adjusted++;
-                            }
+                        if ((zcorn[index2] - zcorn[index1]) * sign < 0 ) {
+                            zcorn[index2] = zcorn[index1];
+                            cells_adjusted++;
                         }
                     }
+                }
+        }
         return cells_adjusted;
     }
 
@@ -167,6 +167,11 @@ namespace Opm {
         std::array<double, 3> getCellCenter(size_t globalIndex) const;
         std::array<double, 3> getCornerPos(size_t i,size_t j, size_t k, size_t corner_index) const;
         const std::vector<double>& activeVolume() const;
+        /// Depth of all active cells, see getCellDepth(); computed along
+        /// with the volumes.
+        const std::vector<double>& activeDepth() const;
+        /// The dx, dy and dz extents of all active cells, see getCellDims().
+        std::vector<std::array<double, 3>> activeCellDims() const;
         double getCellVolume(size_t globalIndex) const;
         double getCellVolume(size_t i , size_t j , size_t k) const;
         double getCellThickness(size_t globalIndex) const;
@@ -248,6 +253,7 @@ namespace Opm {
         double    m_pinchMaxEmptyGap;
 
         mutable std::optional<std::vector<double>> active_volume;
+        mutable std::optional<std::vector<double>> active_depth;
 
         bool m_circle = false;
 
@@ -323,6 +329,10 @@ namespace Opm {
                             std::array<double,8>& Y,
                             std::array<double,8>& Z) const;
 
+        template <typename CellFunction>
+        void visitActiveCellCorners(CellFunction&& cell_function) const;
+        void computeActiveGeometry() const;
+
    };
 
     class CoordMapper {
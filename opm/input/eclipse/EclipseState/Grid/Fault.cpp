@@ -19,6 +19,8 @@
 
 #include <opm/input/eclipse/EclipseState/Grid/Fault.hpp>
 
+#include <algorithm>
+
 namespace Opm {
 
     Fault::Fault(const std::string& faultName) :
@@ -33,6 +35,7 @@ namespace Opm {
         result.m_name = "test";
         result.m_transMult = 1.0;
         result.m_faceList = {FaultFace::serializationTestObject()};
+        result.rasterizeFaces();
 
         return result;
     }
@@ -52,9 +55,30 @@ namespace Opm {
 
 
     void Fault::addFace( FaultFace face ) {
+        this->addFaceIndices( face );
         m_faceList.push_back( std::move( face ) );
     }
 
+    const Fault::FaceIndices& Fault::getFaceIndices() const {
+        return m_faceIndices;
+    }
+
+    void Fault::addFaceIndices(const FaultFace& face) {
+        auto pos = std::find_if(m_faceIndices.begin(), m_faceIndices.end(),
+                                [dir = face.getDir()](const auto& indices)
+                                { return indices.first == dir; });
+        if (pos == m_faceIndices.end())
+            pos = m_faceIndices.insert(pos, { face.getDir(), {} });
+
+        pos->second.insert(pos->second.end(), face.begin(), face.end());
+    }
+
+    void Fault::rasterizeFaces() {
+        m_faceIndices.clear();
+        for (const auto& face : m_faceList)
+            this->addFaceIndices(face);
+    }
+
     std::vector< FaultFace >::const_iterator Fault::begin() const {
         return m_faceList.begin();
     }
@@ -19,8 +19,10 @@
 #ifndef FAULT_HPP_
 #define FAULT_HPP_
 
+#include <cstddef>
 #include <string>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include <opm/input/eclipse/EclipseState/Grid/FaultFace.hpp>
@@ -44,6 +46,11 @@ public:
     std::vector< FaultFace >::const_iterator begin() const;
     std::vector< FaultFace >::const_iterator end() const;
 
+    /// Global cell indices of all the fault faces, one array per face
+    /// direction.
+    using FaceIndices = std::vector<std::pair<FaceDir::DirEnum, std::vector<std::size_t>>>;
+    const FaceIndices& getFaceIndices() const;
+
     bool operator==( const Fault& rhs ) const;
     bool operator!=( const Fault& rhs ) const;
 
@@ -53,12 +60,20 @@ public:
         serializer(m_name);
         serializer(m_transMult);
         serializer(m_faceList);
+
+        if (!serializer.isSerializing()) {
+            this->rasterizeFaces();
+        }
     }
 
 private:
     std::string m_name;
     double m_transMult = 0.0;
     std::vector< FaultFace > m_faceList;
+    FaceIndices m_faceIndices;
+
+    void addFaceIndices(const FaultFace& face);
+    void rasterizeFaces();
 };
 }
 
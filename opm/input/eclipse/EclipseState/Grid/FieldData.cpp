@@ -36,7 +36,7 @@ template <typename T>
 void
 Opm::Fieldprops::FieldData<T>::
 checkInitialisedCopy(const FieldData&                    src,
-                     const std::vector<Box::cell_index>& index_list,
+                     const Box::IndexList&               index_list,
                      const std::string&                  from,
                      const std::string&                  to,
                      const KeywordLocation&              loc,
@@ -44,23 +44,25 @@ checkInitialisedCopy(const FieldData&                    src,
 {
     auto unInit = 0;
 
-    const auto& from_data = global? *src.global_data: src.data;
-    const auto& from_status = global? *src.global_value_status: src.value_status;
-    auto& to_data = global? *this->global_data : this->data;
-    auto& to_status = global? *this->global_value_status : this->value_status;
+    const auto& from_data = global? src.global_data->vector() : src.data.vector();
+    const auto& from_status = global? src.global_value_status->vector() : src.value_status.vector();
+    auto& to_data = global? this->global_data->mutate() : this->data.mutate();
+    auto& to_status = global? this->global_value_status->mutate() : this->value_status.mutate();
 
-    for (const auto& ci : index_list) {
+    for (const auto& range : index_list.ranges()) {
         // This is the global index if global is true and global storage is used.
-        const auto ix = ci.active_index;
-        const auto st = from_status[ix];
+        const auto end = range.active_index + range.size;
+        for (auto ix = range.active_index; ix < end; ++ix) {
+            const auto st = from_status[ix];
 
-        if (st != value::status::deck_value) {
-            ++unInit;
-            continue;
-        }
+            if (st != value::status::deck_value) {
+                ++unInit;
+                continue;
+            }
 
-        to_data[ix] = from_data[ix];
-        to_status[ix] = st;
+            to_data[ix] = from_data[ix];
+            to_status[ix] = st;
+        }
     }
     if (unInit > 0) {
         const auto* plural = (unInit > 1) ? "s" : "";
@@ -78,7 +80,7 @@ would generate an undefined result in {2} block{3} of target array {1}.)",
 template
 void Opm::Fieldprops::FieldData<double>::
 checkInitialisedCopy(const FieldData&,
-                     const std::vector<Box::cell_index>&,
+                     const Box::IndexList&,
                      const std::string&,
                      const std::string&,
                      const KeywordLocation&,
@@ -87,7 +89,7 @@ checkInitialisedCopy(const FieldData&,
 template
 void Opm::Fieldprops::FieldData<int>::
 checkInitialisedCopy(const FieldData&,
-                     const std::vector<Box::cell_index>&,
+                     const Box::IndexList&,
                      const std::string&,
                      const std::string&,
                      const KeywordLocation&,
@@ -28,6 +28,8 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -66,14 +68,143 @@ namespace Opm::Fieldprops {
         data.resize(data.size() - shift);
     }
 
+    /// Reference counted array with copy-on-write semantics.
+    ///
+    /// Copies share the element storage until one of them is modified
+    /// through mutate().  Arrays filled with a single value, which is the
+    /// case for all newly created and all defaulted property arrays, are
+    /// taken from a pool of constant arrays such that e.g. all untouched
+    /// MULT* arrays of a model use the same storage.
+    ///
+    /// References obtained through vector() are not updated by mutate(),
+    /// which may move this array to new storage, and they dangle if all
+    /// other owners of the old storage have gone away.  They must therefore
+    /// not be kept across a modification of the array.
+    template <typename T>
+    class SharedArray
+    {
+    public:
+        SharedArray()
+            : m_data(std::make_shared<std::vector<T>>())
+        {}
+
+        explicit SharedArray(const std::size_t size, const T& value = T{})
+            : m_data(constant(size, value))
+            , m_pooled(true)
+        {}
+
+        SharedArray(std::vector<T> values)
+            : m_data(std::make_shared<std::vector<T>>(std::move(values)))
+        {}
+
+        const std::vector<T>& vector() const { return *this->m_data; }
+        operator const std::vector<T>&() const { return *this->m_data; }
+
+        std::size_t size() const { return this->m_data->size(); }
+        bool empty() const { return this->m_data->empty(); }
+        const T& operator[](const std::size_t i) const { return (*this->m_data)[i]; }
+        const T* data() const { return this->m_data->data(); }
+        auto begin() const { return this->m_data->cbegin(); }
+        auto end() const { return this->m_data->cend(); }
+
+        /// Writable elements.  Makes a private copy of shared or pooled
+        /// storage, the returned reference is invalidated when the array is
+        /// copied.
+        std::vector<T>& mutate()
+        {
+            if (! this->unique()) {
+                this->m_data = std::make_shared<std::vector<T>>(*this->m_data);
+                this->m_pooled = false;
+            }
+
+            return *this->m_data;
+        }
+
+        /// Release the elements; only copies if the storage is shared.
+        std::vector<T> release()
+        {
+            auto values = this->unique()
+                ? std::move(*this->m_data) : *this->m_data;
+
+            this->m_data = std::make_shared<std::vector<T>>();
+            this->m_pooled = false;
+            return values;
+        }
+
+        /// Set all elements to \p value.  Storage which is not shared is
+        /// filled in place, so references obtained through vector() stay
+        /// valid; shared storage is replaced by a pooled constant array.
+        void fill(const T& value)
+        {
+            if (this->unique()) {
+                std::fill(this->m_data->begin(), this->m_data->end(), value);
+            }
+            else {
+                this->m_data = constant(this->size(), value);
+                this->m_pooled = true;
+            }
+        }
+
+        bool operator==(const SharedArray& other) const
+        {
+            return (this->m_data == other.m_data)
+                || (*this->m_data == *other.m_data);
+        }
+
+        bool operator==(const std::vector<T>& other) const
+        {
+            return *this->m_data == other;
+        }
+
+    private:
+        std::shared_ptr<std::vector<T>> m_data;
+        bool m_pooled{false};
+
+        bool unique() const
+        {
+            return !this->m_pooled && (this->m_data.use_count() == 1);
+        }
+
+        static std::shared_ptr<std::vector<T>>
+        constant(const std::size_t size, const T& value)
+        {
+            struct Entry
+            {
+                std::size_t size;
+                T value;
+                std::weak_ptr<std::vector<T>> data;
+            };
+
+            static std::mutex pool_mutex;
+            static std::vector<Entry> pool;
+
+            std::lock_guard<std::mutex> lock(pool_mutex);
+            pool.erase(std::remove_if(pool.begin(), pool.end(),
+                                      [](const Entry& entry) { return entry.data.expired(); }),
+                       pool.end());
+
+            for (const auto& entry : pool) {
+                if ((entry.size == size) && (entry.value == value)) {
+                    if (auto data = entry.data.lock(); data != nullptr) {
+                        return data;
+                    }
+                }
+            }
+
+            auto data = std::make_shared<std::vector<T>>(size, value);
+            pool.push_back({ size, value, data });
+            return data;
+        }
+    };
+
     template <typename T>
     struct FieldData
     {
-        std::vector<T> data{};
-        std::vector<value::status> value_status{};
+        SharedArray<T> data{};
+        SharedArray<value::status> value_status{};
         keywords::keyword_info<T> kw_info{};
-        std::optional<std::vector<T>> global_data{};
-        std::optional<std::vector<value::status>> global_value_status{std::nullopt};
+        std::optional<SharedArray<T>> global_data{};
+        std::optional<SharedArray<value::status>> global_value_status{std::nullopt};
         mutable bool all_set{false};
 
         bool operator==(const FieldData& other) const
@@ -90,13 +221,13 @@ namespace Opm::Fieldprops {
         FieldData(const keywords::keyword_info<T>& info,
                   const std::size_t                active_size,
                   const std::size_t                global_size)
-            : data        (active_size * info.num_value)
+            : data        (active_size * info.num_value, T{})
             , value_status(active_size * info.num_value, value::status::uninitialized)
             , kw_info     (info)
             , all_set     (false)
         {
             if (global_size != 0) {
-                this->global_data.emplace(global_size * this->numValuePerCell());
+                this->global_data.emplace(global_size * this->numValuePerCell(), T{});
                 this->global_value_status.emplace(global_size * this->numValuePerCell(), value::status::uninitialized);
             }
 
@@ -148,12 +279,12 @@ namespace Opm::Fieldprops {
 
         void compress(const std::vector<bool>& active_map)
         {
-            Fieldprops::compress(this->data, active_map, this->numValuePerCell());
-            Fieldprops::compress(this->value_status, active_map, this->numValuePerCell());
+            Fieldprops::compress(this->data.mutate(), active_map, this->numValuePerCell());
+            Fieldprops::compress(this->value_status.mutate(), active_map, this->numValuePerCell());
         }
 
         void checkInitialisedCopy(const FieldData&                    src,
-                                  const std::vector<Box::cell_index>& index_list,
+                                  const Box::IndexList&               index_list,
                                   const std::string&                  from,
                                   const std::string&                  to,
                                   const KeywordLocation&              loc,
@@ -161,18 +292,12 @@ namespace Opm::Fieldprops {
 
         void default_assign(T value)
         {
-            std::fill(this->data.begin(), this->data.end(), value);
-            std::fill(this->value_status.begin(),
-                      this->value_status.end(),
-                      value::status::valid_default);
+            this->data.fill(value);
+            this->value_status.fill(value::status::valid_default);
 
             if (this->global_data) {
-                std::fill(this->global_data->begin(),
-                          this->global_data->end(), value);
-
-                std::fill(this->global_value_status->begin(),
-                          this->global_value_status->end(),
-                          value::status::valid_default);
+                this->global_data->fill(value);
+                this->global_value_status->fill(value::status::valid_default);
             }
         }
 
@@ -185,9 +310,8 @@ namespace Opm::Fieldprops {
                 };
             }
 
-            std::copy(src.begin(), src.end(), this->data.begin());
-            std::fill(this->value_status.begin(), this->value_status.end(),
-                      value::status::valid_default);
+            this->data = src;
+            this->value_status.fill(value::status::valid_default);
         }
 
         void default_update(const std::vector<T>& src)
@@ -199,10 +323,18 @@ namespace Opm::Fieldprops {
                 };
             }
 
+            if (std::all_of(this->value_status.begin(), this->value_status.end(),
+                            [](const value::status& status) { return value::has_value(status); }))
+            {
+                return;
+            }
+
+            auto& data_values = this->data.mutate();
+            auto& status_values = this->value_status.mutate();
             for (std::size_t i = 0; i < src.size(); ++i) {
-                if (!value::has_value(this->value_status[i])) {
-                    this->value_status[i] = value::status::valid_default;
-                    this->data[i] = src[i];
+                if (!value::has_value(status_values[i])) {
+                    status_values[i] = value::status::valid_default;
+                    data_values[i] = src[i];
                 }
             }
         }
@@ -211,8 +343,8 @@ namespace Opm::Fieldprops {
                     T value,
                     const value::status status)
         {
-            this->data[index] = value;
-            this->value_status[index] = status;
+            this->data.mutate()[index] = value;
+            this->value_status.mutate()[index] = status;
         }
     };
 
@@ -329,33 +329,39 @@ void assign_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
 {
     verify_deck_data(kw_info, keyword, deck_data, box);
 
-    for (const auto& cell_index : box.index_list()) {
-        auto active_index = cell_index.active_index;
-        auto data_index = cell_index.data_index;
-        for (size_t i = 0; i < kw_info.num_value; ++i) {
-            auto deck_data_index = i* box.size() + data_index;
-            if (value::has_value(deck_status[deck_data_index])) {
-                auto data_active_index = i * box.size() + active_index;
-                if (deck_status[deck_data_index] == value::status::deck_value ||
-                    field_data.value_status[data_active_index] == value::status::uninitialized) {
-                    field_data.data[data_active_index] = deck_data[deck_data_index];
-                    field_data.value_status[data_active_index] = deck_status[deck_data_index];
+    for (size_t i = 0; i < kw_info.num_value; ++i) {
+        for (const auto& range : box.index_list().ranges()) {
+            const auto* deck_value = deck_data.data() + i*box.size() + range.data_index;
+            const auto* deck_value_status = deck_status.data() + i*box.size() + range.data_index;
+            auto* data = field_data.data.mutate().data() + i*box.size() + range.active_index;
+            auto* status = field_data.value_status.mutate().data() + i*box.size() + range.active_index;
+
+            for (std::size_t n = 0; n < range.size; ++n) {
+                if (value::has_value(deck_value_status[n]) &&
+                    (deck_value_status[n] == value::status::deck_value ||
+                     status[n] == value::status::uninitialized))
+                {
+                    data[n] = deck_value[n];
+                    status[n] = deck_value_status[n];
                 }
             }
         }
     }
 
     if (kw_info.global) {
-        auto& global_data = field_data.global_data.value();
-        auto& global_status = field_data.global_value_status.value();
-        const auto& index_list = box.global_index_list();
-
-        for (const auto& cell : index_list) {
-            if ((deck_status[cell.data_index] == value::status::deck_value) ||
-                (global_status[cell.global_index] == value::status::uninitialized))
-            {
-                global_data[cell.global_index] = deck_data[cell.data_index];
-                global_status[cell.global_index] = deck_status[cell.data_index];
+        auto& global_data = field_data.global_data->mutate();
+        auto& global_status = field_data.global_value_status->mutate();
+
+        for (const auto& range : box.global_index_list().ranges()) {
+            for (std::size_t n = 0; n < range.size; ++n) {
+                const auto data_index = range.data_index + n;
+                const auto global_index = range.global_index + n;
+                if ((deck_status[data_index] == value::status::deck_value) ||
+                    (global_status[global_index] == value::status::uninitialized))
+                {
+                    global_data[global_index] = deck_data[data_index];
+                    global_status[global_index] = deck_status[data_index];
+                }
             }
         }
     }
@@ -370,29 +376,36 @@ void multiply_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
                    const Box& box)
 {
     verify_deck_data(kw_info, keyword, deck_data, box);
-    for (const auto& cell_index : box.index_list()) {
-        auto active_index = cell_index.active_index;
-        auto data_index = cell_index.data_index;
-
-        if (value::has_value(deck_status[data_index]) &&
-            value::has_value(field_data.value_status[active_index]))
-        {
-            field_data.data[active_index] *= deck_data[data_index];
-            field_data.value_status[active_index] = deck_status[data_index];
+    auto& data = field_data.data.mutate();
+    auto& status = field_data.value_status.mutate();
+    for (const auto& range : box.index_list().ranges()) {
+        for (std::size_t n = 0; n < range.size; ++n) {
+            const auto active_index = range.active_index + n;
+            const auto data_index = range.data_index + n;
+
+            if (value::has_value(deck_status[data_index]) &&
+                value::has_value(status[active_index]))
+            {
+                data[active_index] *= deck_data[data_index];
+                status[active_index] = deck_status[data_index];
+            }
         }
     }
 
     if (kw_info.global) {
-        auto& global_data = field_data.global_data.value();
-        auto& global_status = field_data.global_value_status.value();
-        const auto& index_list = box.global_index_list();
-
-        for (const auto& cell : index_list) {
-            if ((deck_status[cell.data_index] == value::status::deck_value) ||
-                (global_status[cell.global_index] == value::status::uninitialized))
-            {
-                global_data[cell.global_index] *= deck_data[cell.data_index];
-                global_status[cell.global_index] = deck_status[cell.data_index];
+        auto& global_data = field_data.global_data->mutate();
+        auto& global_status = field_data.global_value_status->mutate();
+
+        for (const auto& range : box.global_index_list().ranges()) {
+            for (std::size_t n = 0; n < range.size; ++n) {
+                const auto data_index = range.data_index + n;
+                const auto global_index = range.global_index + n;
+                if ((deck_status[data_index] == value::status::deck_value) ||
+                    (global_status[global_index] == value::status::uninitialized))
+                {
+                    global_data[global_index] *= deck_data[data_index];
+                    global_status[global_index] = deck_status[data_index];
+                }
             }
         }
     }
@@ -402,11 +415,12 @@ template <typename T>
 void assign_scalar(std::vector<T>&                     data,
                    std::vector<value::status>&         value_status,
                    const T                             value,
-                   const std::vector<Box::cell_index>& index_list)
+                   const Box::IndexList&               index_list)
 {
-    for (const auto& cell_index : index_list) {
-        data[cell_index.active_index] = value;
-        value_status[cell_index.active_index] = value::status::deck_value;
+    for (const auto& range : index_list.ranges()) {
+        std::fill_n(data.begin() + range.active_index, range.size, value);
+        std::fill_n(value_status.begin() + range.active_index, range.size,
+                    value::status::deck_value);
     }
 }
 
@@ -416,18 +430,19 @@ void multiply_scalar(const KeywordLocation&              loc,
                      std::vector<T>&                     data,
                      std::vector<value::status>&         value_status,
                      const T                             value,
-                     const std::vector<Box::cell_index>& index_list)
+                     const Box::IndexList&               index_list)
 {
     auto unInit = 0;
 
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] *= value;
-        }
-        else {
-            ++unInit;
+    for (const auto& range : index_list.ranges()) {
+        const auto end = range.active_index + range.size;
+        for (auto ix = range.active_index; ix < end; ++ix) {
+            if (value::has_value(value_status[ix])) {
+                data[ix] *= value;
+            }
+            else {
+                ++unInit;
+            }
         }
     }
 
@@ -444,18 +459,19 @@ void add_scalar(const KeywordLocation&              loc,
                 std::vector<T>&                     data,
                 std::vector<value::status>&         value_status,
                 const T                             value,
-                const std::vector<Box::cell_index>& index_list)
+                const Box::IndexList&               index_list)
 {
     auto unInit = 0;
 
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] += value;
-        }
-        else {
-            ++unInit;
+    for (const auto& range : index_list.ranges()) {
+        const auto end = range.active_index + range.size;
+        for (auto ix = range.active_index; ix < end; ++ix) {
+            if (value::has_value(value_status[ix])) {
+                data[ix] += value;
+            }
+            else {
+                ++unInit;
+            }
         }
     }
 
@@ -472,18 +488,19 @@ void min_value(const KeywordLocation&              loc,
                std::vector<T>&                     data,
                std::vector<value::status>&         value_status,
                const T                             value,
-               const std::vector<Box::cell_index>& index_list)
+               const Box::IndexList&               index_list)
 {
     auto unInit = 0;
 
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] = std::max(data[ix], value);
-        }
-        else {
-            ++unInit;
+    for (const auto& range : index_list.ranges()) {
+        const auto end = range.active_index + range.size;
+        for (auto ix = range.active_index; ix < end; ++ix) {
+            if (value::has_value(value_status[ix])) {
+                data[ix] = std::max(data[ix], value);
+            }
+            else {
+                ++unInit;
+            }
         }
     }
 
@@ -501,18 +518,19 @@ void max_value(const KeywordLocation&              loc,
                std::vector<T>&                     data,
                std::vector<value::status>&         value_status,
                const T                             value,
-               const std::vector<Box::cell_index>& index_list)
+               const Box::IndexList&               index_list)
 {
     auto unInit = 0;
 
-    for (const auto& cell_index : index_list) {
-        const auto ix = cell_index.active_index;
-
-        if (value::has_value(value_status[ix])) {
-            data[ix] = std::min(data[ix], value);
-        }
-        else {
-            ++unInit;
+    for (const auto& range : index_list.ranges()) {
+        const auto end = range.active_index + range.size;
+        for (auto ix = range.active_index; ix < end; ++ix) {
+            if (value::has_value(value_status[ix])) {
+                data[ix] = std::min(data[ix], value);
+            }
+            else {
+                ++unInit;
+            }
         }
     }
 
@@ -527,18 +545,20 @@ void max_value(const KeywordLocation&              loc,
 
 template<typename T>
 void update_global_from_local(Fieldprops::FieldData<T>& data,
-                              const std::vector<Box::cell_index>& index_list)
+                              const Box::IndexList& index_list)
 {
     if(data.global_data)
     {
-        auto& to = *data.global_data;
-        auto to_st = *data.global_value_status;
+        auto& to = data.global_data->mutate();
+        auto to_st = data.global_value_status->vector();
         const auto& from = data.data;
         const auto& from_st = data.value_status;
 
-        for (const auto& cell_index : index_list) {
-            to[cell_index.global_index] = from[cell_index.active_index];
-            to_st[cell_index.global_index] = from_st[cell_index.active_index];
+        for (const auto& range : index_list.ranges()) {
+            std::copy_n(from.begin() + range.active_index, range.size,
+                        to.begin() + range.global_index);
+            std::copy_n(from_st.begin() + range.active_index, range.size,
+                        to_st.begin() + range.global_index);
         }
     }
 }
@@ -550,7 +570,7 @@ void apply(const Fieldprops::ScalarOperation   op,
            std::vector<T>&                     data,
            std::vector<value::status>&         value_status,
            const T                             scalar_value,
-           const std::vector<Box::cell_index>& index_list)
+           const Box::IndexList&               index_list)
 {
     switch (op) {
     case Fieldprops::ScalarOperation::EQUAL:
@@ -642,13 +662,7 @@ std::vector<double> extract_cell_volume(const EclipseGrid& grid)
 
 std::vector<double> extract_cell_depth(const EclipseGrid& grid)
 {
-    std::vector<double> cell_depth(grid.getNumActive());
-
-    for (std::size_t active_index = 0; active_index < grid.getNumActive(); ++active_index) {
-        cell_depth[active_index] = grid.getCellDepth(grid.getGlobalIndex(active_index));
-    }
-
-    return cell_depth;
+    return grid.activeDepth();
 }
 
 // The rst_compare_data function compares the main std::map<std::string,
@@ -797,8 +811,8 @@ FieldProps::FieldProps(const Deck& deck,
         const bool has_pvtnum = this->int_data.count("PVTNUM") != 0;
         const bool has_satnum = this->int_data.count("SATNUM") != 0;
 
-        std::vector<int>* pvtnum = has_pvtnum ? &(this->int_data["PVTNUM"].data) : nullptr;
-        std::vector<int>* satnum = has_satnum ? &(this->int_data["SATNUM"].data) : nullptr;
+        std::vector<int>* pvtnum = has_pvtnum ? &(this->int_data["PVTNUM"].data.mutate()) : nullptr;
+        std::vector<int>* satnum = has_satnum ? &(this->int_data["SATNUM"].data.mutate()) : nullptr;
         for (const auto& [globCell, regionID] : aqcell_tabnums) {
             const auto aix = grid.activeIndex(globCell);
             if (has_pvtnum) { (*pvtnum)[aix] = std::max(regionID[0], (*pvtnum)[aix]); }
@@ -922,11 +936,15 @@ void FieldProps::distribute_toplayer(Fieldprops::FieldData<double>& field_data,
 {
     const std::size_t layer_size = this->nx * this->ny;
     Fieldprops::FieldData<double> toplayer(field_data.kw_info, layer_size, 0);
-    for (const auto& cell_index : box.index_list()) {
-        if (cell_index.global_index < layer_size) {
-            toplayer.data[cell_index.global_index] = deck_data[cell_index.data_index];
-            toplayer.value_status[cell_index.global_index] = value::status::deck_value;
-        }
+    for (const auto& range : box.index_list().ranges()) {
+        if (range.global_index >= layer_size)
+            continue;
+
+        const auto size = std::min(range.size, layer_size - range.global_index);
+        std::copy_n(deck_data.begin() + range.data_index, size,
+                    toplayer.data.mutate().begin() + range.global_index);
+        std::fill_n(toplayer.value_status.mutate().begin() + range.global_index, size,
+                    value::status::deck_value);
     }
 
     std::size_t active_index = 0;
@@ -938,8 +956,8 @@ void FieldProps::distribute_toplayer(Fieldprops::FieldData<double>& field_data,
                     if (field_data.value_status[active_index] == value::status::uninitialized) {
                         std::size_t layer_index = i + j*this->nx;
                         if (toplayer.value_status[layer_index] == value::status::deck_value) {
-                            field_data.data[active_index] = toplayer.data[layer_index];
-                            field_data.value_status[active_index] = value::status::valid_default;
+                            field_data.update(active_index, toplayer.data[layer_index],
+                                              value::status::valid_default);
                         }
                     }
                     active_index += 1;
@@ -1081,10 +1099,10 @@ FieldProps::init_get(const std::string& keyword, bool)
     return this->init_get(keyword, Fieldprops::keywords::global_kw_info<int>(keyword));
 }
 
-std::pair<std::vector<Box::cell_index>,bool>
+std::pair<Box::IndexList,bool>
 FieldProps::region_index(const std::string& region_name, const int region_value)
 {
-    std::vector<Box::cell_index> index_list;
+    Box::IndexList index_list;
     bool all_active = true;
     const auto& region = this->init_get<int>(region_name);
     if (!region.valid()) {
@@ -1095,7 +1113,7 @@ FieldProps::region_index(const std::string& region_name, const int region_value)
     for (std::size_t g = 0; g < this->m_actnum.size(); ++g) {
         if (this->m_actnum[g] != 0) {
             if (region.data[active_index] == region_value) {
-                index_list.emplace_back(g, active_index, g);
+                index_list.push_back(Box::cell_index{g, active_index, g});
             }
 
             active_index += 1;
@@ -1162,8 +1180,9 @@ void FieldProps::apply_multipliers()
                 .first;
         }
 
-        std::transform(iter->second.data.begin(), iter->second.data.end(),
-                       mult_iter->second.data.begin(), iter->second.data.begin(),
+        auto& data = iter->second.data.mutate();
+        std::transform(data.begin(), data.end(),
+                       mult_iter->second.data.begin(), data.begin(),
                        std::multiplies<>());
 
         // If data is global, then we also need to set the global_data. I think they should be the same at this stage, though!
@@ -1171,10 +1190,11 @@ void FieldProps::apply_multipliers()
         {
             assert(mult_iter->second.global_data.has_value());
             assert(iter->second.global_data.has_value());
-            std::transform(iter->second.global_data->begin(),
-                           iter->second.global_data->end(),
+            auto& global_data = iter->second.global_data->mutate();
+            std::transform(global_data.begin(),
+                           global_data.end(),
                            mult_iter->second.global_data->begin(),
-                           iter->second.global_data->begin(),
+                           global_data.begin(),
                            std::multiplies<>());
         }
         // If this is MULTPV we also need to apply the additional multiplier to PORV if that was initialized already.
@@ -1182,7 +1202,7 @@ void FieldProps::apply_multipliers()
         // current MULTPV.
         if (keyword == ParserKeywords::MULTPV::keywordName && !hasPorvBefore) {
             auto& porv = this->init_get<double>(ParserKeywords::PORV::keywordName);
-            auto& porv_data = porv.data;
+            auto& porv_data = porv.data.mutate();
             std::transform(porv_data.begin(), porv_data.end(), mult_iter->second.data.begin(), porv_data.begin(), std::multiplies<>());
         }
         this->double_data.erase(mult_iter);
@@ -1251,7 +1271,7 @@ std::vector<int> FieldProps::extract<int>(const std::string& keyword)
     auto field_iter = this->int_data.find(keyword);
 
     auto field = std::move(field_iter->second);
-    std::vector<int> data = std::move(field.data);
+    std::vector<int> data = field.data.release();
 
     this->int_data.erase(field_iter);
 
@@ -1264,7 +1284,7 @@ std::vector<double> FieldProps::extract<double>(const std::string& keyword)
     auto field_iter = this->double_data.find(keyword);
 
     auto field = std::move(field_iter->second);
-    std::vector<double> data = std::move(field.data);
+    std::vector<double> data = field.data.release();
 
     this->double_data.erase(field_iter);
 
@@ -1372,55 +1392,82 @@ double FieldProps::get_beta(const std::string& func_name,
         : raw_beta;
 }
 
-template <typename T>
-void FieldProps::operate(const DeckRecord&                   record,
-                         Fieldprops::FieldData<T>&           target_data,
-                         const Fieldprops::FieldData<T>&     src_data,
-                         const std::vector<Box::cell_index>& index_list,
-                         const bool                          global)
-{
-    const auto target_array = record.getItem("TARGET_ARRAY").getTrimmedString(0);
-    if (this->tran.find(target_array) != this->tran.end()) {
-        throw std::logic_error {
-            "The OPERATE keyword cannot be used for "
-            "manipulations of TRANX, TRANY or TRANZ"
-        };
-    }
+void FieldProps::operate(const std::vector<OperateStep>&  steps,
+                         Fieldprops::FieldData<double>&   target_data,
+                         const Box::IndexList&            index_list,
+                         const bool                       global)
+{
+    struct Kernel
+    {
+        Operate::kernel kernel;
+        double alpha;
+        double beta;
+        bool check_target;
+        const double* from_data;
+        const value::status* from_status;
+    };
 
-    const auto func_name    = record.getItem("OPERATION").getTrimmedString(0);
-    const auto check_target = (func_name == "MULTIPLY") || (func_name == "POLY");
+    // Detach the target from shared storage before taking the source
+    // pointers, such that records reading the target itself see the
+    // results of the preceding records.
+    auto* to_data = global ? target_data.global_data->mutate().data() : target_data.data.mutate().data();
+    auto* to_status = global ? target_data.global_value_status->mutate().data() : target_data.value_status.mutate().data();
+
+    std::vector<Kernel> kernels;
+    kernels.reserve(steps.size());
+    for (const auto& [record, src_data] : steps) {
+        const auto target_array = record->getItem("TARGET_ARRAY").getTrimmedString(0);
+        if (this->tran.find(target_array) != this->tran.end()) {
+            throw std::logic_error {
+                "The OPERATE keyword cannot be used for "
+                "manipulations of TRANX, TRANY or TRANZ"
+            };
+        }
 
-    const auto alpha = this->get_alpha(func_name, target_array, record.getItem("PARAM1").get<double>(0));
-    const auto beta  = this->get_beta(func_name, target_array, record.getItem("PARAM2").get<double>(0));
-    const auto func  = Operate::get(func_name, alpha, beta);
+        const auto func_name = record->getItem("OPERATION").getTrimmedString(0);
+        kernels.push_back({
+            Operate::get(func_name),
+            this->get_alpha(func_name, target_array, record->getItem("PARAM1").get<double>(0)),
+            this->get_beta(func_name, target_array, record->getItem("PARAM2").get<double>(0)),
+            (func_name == "MULTIPLY") || (func_name == "POLY"),
+            global ? src_data->global_data->data() : src_data->data.data(),
+            global ? src_data->global_value_status->data() : src_data->value_status.data()
+        });
+    }
 
-    auto& to_data = global? *target_data.global_data : target_data.data;
-    auto& to_status = global? *target_data.global_value_status : target_data.value_status;
-    const auto& from_data = global? *src_data.global_data : src_data.data;
-    auto& from_status = global? *src_data.global_value_status : src_data.value_status;
+    const auto has_value = [](const value::status* status, const std::size_t n)
+    {
+        return std::all_of(status, status + n, [](const value::status st) { return value::has_value(st); });
+    };
 
-    for (const auto& cell_index : index_list) {
+    // All operations are applied to one chunk of cells before moving on to
+    // the next, so that the target values stay in cache between operations.
+    constexpr std::size_t chunk_size = 1024;
+    for (const auto& range : index_list.ranges()) {
         // This is the global index if global is true and global storage is used.
-        const auto ix = cell_index.active_index;
+        for (std::size_t offset = 0; offset < range.size; offset += chunk_size) {
+            const auto begin = range.active_index + offset;
+            const auto n = std::min(chunk_size, range.size - offset);
+
+            for (const auto& kernel : kernels) {
+                if (! has_value(kernel.from_status + begin, n)) {
+                    throw std::invalid_argument {
+                        "Tried to use unset property value in "
+                        "OPERATE/OPERATER keyword"
+                    };
+                }
 
-        if (value::has_value(from_status[ix])) {
-            if (!check_target || value::has_value(to_status[ix])) {
-                to_data[ix] = func(to_data[ix], from_data[ix]);
-                to_status[ix] = from_status[ix];
-            }
-            else {
-                throw std::invalid_argument {
-                    "Tried to use unset property value "
-                    "in OPERATE/OPERATER keyword"
-                };
+                if (kernel.check_target && ! has_value(to_status + begin, n)) {
+                    throw std::invalid_argument {
+                        "Tried to use unset property value "
+                        "in OPERATE/OPERATER keyword"
+                    };
+                }
+
+                kernel.kernel(to_data + begin, kernel.from_data + begin, n, kernel.alpha, kernel.beta);
+                std::copy_n(kernel.from_status + begin, n, to_status + begin);
             }
         }
-        else {
-            throw std::invalid_argument {
-                "Tried to use unset property value in "
-                "OPERATE/OPERATER keyword"
-            };
-        }
     }
 }
 
@@ -1470,7 +1517,7 @@ void FieldProps::handle_operateR(const DeckKeyword& keyword)
         }
 
         const auto& src_data = this->init_get<double>(src_kw);
-        FieldProps::operate(record, field_data, src_data, index_list);
+        this->operate({ OperateStep { &record, &src_data } }, field_data, index_list);
 
         // Supporting region operations on global storage arrays would
         // require global storage for the *NUM region set arrays (i.e.,
@@ -1545,7 +1592,7 @@ void FieldProps::handle_region_operation(const DeckKeyword& keyword)
                 this->getSIValue(operation, target_kw, record.getItem(1).get<double>(0));
 
             apply(operation, keyword.location(), target_kw,
-                  field_data.data, field_data.value_status,
+                  field_data.data.mutate(), field_data.value_status.mutate(),
                   scalar_value, index_list);
 
             // Supporting region operations on global storage arrays would
@@ -1590,29 +1637,61 @@ void FieldProps::handle_OPERATE(const DeckKeyword& keyword, Box box)
     // values overwrite the corresponding elements of the result/target
     // array (ResArray).
 
-    for (const auto& record : keyword) {
-        box.update(record);
-
-        const auto target_kw = Fieldprops::keywords::
-            get_keyword_from_alias(record.getItem(0).getTrimmedString(0));
+    auto target_array = [](const DeckRecord& record)
+    {
+        return Fieldprops::keywords::get_keyword_from_alias(record.getItem(0).getTrimmedString(0));
+    };
 
+    // Consecutive records operating on the same target array within the
+    // same box are applied in a single pass.  A source array which does not
+    // exist yet ends the pass, as it must be initialised after the
+    // preceding records have been applied - e.g. PORV is computed from the
+    // current PORO values.
+    auto record_index = std::size_t{0};
+    while (record_index < keyword.size()) {
+        const auto& first = keyword.getRecord(record_index);
+        box.update(first);
+
+        const auto target_kw = target_array(first);
         auto& field_data = this->init_get<double>(target_kw);
 
-        const auto src_kw = record.getItem("ARRAY").getTrimmedString(0);
-        const auto& src_data = this->init_get<double>(src_kw);
+        std::vector<OperateStep> steps;
+        for (; record_index < keyword.size(); ++record_index) {
+            const auto& record = keyword.getRecord(record_index);
+            const auto src_kw = Fieldprops::keywords::
+                get_keyword_from_alias(record.getItem("ARRAY").getTrimmedString(0));
+
+            if (! steps.empty()) {
+                if (target_array(record) != target_kw)
+                    break;
+
+                auto record_box = box;
+                record_box.update(record);
+                if (! (record_box == box))
+                    break;
 
-        FieldProps::operate(record, field_data, src_data, box.index_list());
+                if (this->double_data.find(src_kw) == this->double_data.end())
+                    break;
+            }
+
+            steps.push_back({ &record, &this->init_get<double>(src_kw) });
+        }
+
+        this->operate(steps, field_data, box.index_list());
 
         if (field_data.global_data)
         {
-            if (!src_data.global_data) {
+            const auto all_global = std::all_of(steps.begin(), steps.end(),
+                                                [](const auto& step)
+                                                { return step.src_data->global_data.has_value(); });
+            if (!all_global) {
                 throw std::logic_error {
                     "The OPERATE and OPERATER keywords are only "
                     "supported between keywords with same storage"
                 };
             }
 
-            FieldProps::operate(record, field_data, src_data, box.global_index_list(), true);
+            this->operate(steps, field_data, box.global_index_list(), true);
         }
     }
 }
@@ -1711,13 +1790,13 @@ void FieldProps::handle_operation(const Section      section,
                 (unique_name, kw_info, /* multiplier_in_edit =*/ editSect && kw_info.multiplier);
 
             apply(operation, keyword.location(), target_kw,
-                  field_data.data, field_data.value_status,
+                  field_data.data.mutate(), field_data.value_status.mutate(),
                   scalar_value, box.index_list());
 
             if (field_data.global_data) {
                 apply(operation, keyword.location(), target_kw,
-                      *field_data.global_data,
-                      *field_data.global_value_status,
+                      field_data.global_data->mutate(),
+                      field_data.global_value_status->mutate(),
                       scalar_value, box.global_index_list());
             }
 
@@ -1739,8 +1818,8 @@ void FieldProps::handle_operation(const Section      section,
             auto& field_data = this->init_get<int>(target_kw);
 
             apply(operation, keyword.location(), target_kw,
-                  field_data.data,
-                  field_data.value_status,
+                  field_data.data.mutate(),
+                  field_data.value_status.mutate(),
                   scalar_value, box.index_list());
 
             continue;
@@ -1767,7 +1846,7 @@ void FieldProps::handle_COPY(const DeckKeyword& keyword,
         const auto src_kw    = arrayName(record.getItem(0));
         const auto target_kw = arrayName(record.getItem(1));
 
-        std::vector<Box::cell_index> index_list;
+        Box::IndexList index_list;
         auto srcDescr = std::string {};
 
         if (isRegionOperation) {
@@ -1878,8 +1957,8 @@ void FieldProps::init_tempi(Fieldprops::FieldData<double>& tempi)
 
 void FieldProps::init_porv(Fieldprops::FieldData<double>& porv)
 {
-    auto& porv_data = porv.data;
-    auto& porv_status = porv.value_status;
+    auto& porv_data = porv.data.mutate();
+    auto& porv_status = porv.value_status.mutate();
 
     const auto& poro = this->init_get<double>("PORO");
     const auto& poro_status = poro.value_status;
@@ -1905,8 +1984,10 @@ void FieldProps::init_porv(Fieldprops::FieldData<double>& porv)
 
     for (const auto& mregp: this->multregp) {
         const auto index_list = this->region_index(mregp.region_name, mregp.region_value).first;
-        for (const auto& cell_index : index_list)
-            porv_data[cell_index.active_index] *= mregp.multiplier;
+        for (const auto& range : index_list.ranges()) {
+            std::for_each_n(porv_data.begin() + range.active_index, range.size,
+                            [multiplier = mregp.multiplier](double& pv) { pv *= multiplier; });
+        }
     }
 }
 
@@ -2283,14 +2364,14 @@ bool FieldProps::tran_active(const std::string& keyword) const
 
 void FieldProps::apply_numerical_aquifers(const NumericalAquifers& numerical_aquifers)
 {
-    auto& porv_data = this->init_get<double>("PORV").data;
-    auto& poro_data = this->init_get<double>("PORO").data;
-    auto& satnum_data = this->init_get<int>("SATNUM").data;
-    auto& pvtnum_data = this->init_get<int>("PVTNUM").data;
+    auto& porv_data = this->init_get<double>("PORV").data.mutate();
+    auto& poro_data = this->init_get<double>("PORO").data.mutate();
+    auto& satnum_data = this->init_get<int>("SATNUM").data.mutate();
+    auto& pvtnum_data = this->init_get<int>("PVTNUM").data.mutate();
 
-    auto& permx_data = this->init_get<double>("PERMX").data;
-    auto& permy_data = this->init_get<double>("PERMY").data;
-    auto& permz_data = this->init_get<double>("PERMZ").data;
+    auto& permx_data = this->init_get<double>("PERMX").data.mutate();
+    auto& permy_data = this->init_get<double>("PERMY").data.mutate();
+    auto& permz_data = this->init_get<double>("PERMZ").data.mutate();
 
     const auto& aqu_cell_props = numerical_aquifers.aquiferCellProps();
     for (const auto& [global_index, cellprop] : aqu_cell_props) {
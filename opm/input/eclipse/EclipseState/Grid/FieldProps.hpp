@@ -467,7 +467,7 @@ public:
         const std::vector<T>* ptr() const
         {
             return (this->data_ptr != nullptr)
-                ? &this->data_ptr->data
+                ? &this->data_ptr->data.vector()
                 : nullptr;
         }
 
@@ -620,8 +620,8 @@ public:
             template global_kw_info<T>(keyword);
 
         return kw_info.global
-            ? *field_data.global_data
-            : this->global_copy(field_data.data, kw_info.scalar_init);
+            ? field_data.global_data->vector()
+            : this->global_copy(field_data.data.vector(), kw_info.scalar_init);
     }
 
     template <typename T>
@@ -640,7 +640,7 @@ public:
         const auto& field_data = this->template try_get<T>(keyword).field_data();
 
         if (has0) {
-            return this->get_copy(field_data.data, field_data.kw_info.scalar_init, global);
+            return this->get_copy(field_data.data.vector(), field_data.kw_info.scalar_init, global);
         }
 
         const auto initial_value = Fieldprops::keywords::
@@ -745,11 +745,18 @@ private:
         return (! global) ? std::move(x) : this->global_copy(x, initial_value);
     }
 
-    template <typename T>
-    void operate(const DeckRecord& record,
-                 Fieldprops::FieldData<T>& target_data,
-                 const Fieldprops::FieldData<T>& src_data,
-                 const std::vector<Box::cell_index>& index_list,
+    // One OPERATE/OPERATER record along with its source array.
+    struct OperateStep
+    {
+        const DeckRecord* record;
+        const Fieldprops::FieldData<double>* src_data;
+    };
+
+    // Apply a sequence of operations on the same target array in a single
+    // pass over the cells.
+    void operate(const std::vector<OperateStep>& steps,
+                 Fieldprops::FieldData<double>& target_data,
+                 const Box::IndexList& index_list,
                  const bool global = false);
 
     template <typename T>
@@ -764,7 +771,7 @@ private:
 
     std::string region_name(const DeckItem& region_item) const;
 
-    std::pair<std::vector<Box::cell_index>,bool>
+    std::pair<Box::IndexList,bool>
     region_index(const std::string& region_name, int region_value);
 
     void handle_OPERATE(const DeckKeyword& keyword, Box box);
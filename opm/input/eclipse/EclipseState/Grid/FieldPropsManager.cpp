@@ -147,9 +147,9 @@ std::vector<int> FieldPropsManager::actnum() const {
 std::vector<double> FieldPropsManager::porv(bool global) const {
     const auto& field_data = this->fp->try_get<double>("PORV").field_data();
     if (global)
-        return this->fp->global_copy(field_data.data, field_data.kw_info.scalar_init);
+        return this->fp->global_copy(field_data.data.vector(), field_data.kw_info.scalar_init);
     else
-        return field_data.data;
+        return field_data.data.vector();
 }
 
 std::size_t FieldPropsManager::active_size() const {
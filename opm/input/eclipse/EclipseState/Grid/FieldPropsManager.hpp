@@ -269,6 +269,12 @@ private:
       initialize if it is not already in the container. The different exceptions
       raised for the different error conditions are the same for get(),
       get_copy() and get_global().
+
+      The returned reference, and the references returned by get_int() and
+      get_double(), refer to storage which may be shared with other arrays.
+      They are only valid until the keyword is next modified, e.g. by
+      apply_schedule_keywords(); the keyword must then be fetched again.
+      Use get_copy() to hold on to the values.
     */
     template <typename T>
     const std::vector<T>& get(const std::string& keyword) const;
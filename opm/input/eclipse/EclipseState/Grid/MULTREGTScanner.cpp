@@ -34,6 +34,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <stdexcept>
 #include <string>
@@ -78,6 +79,18 @@ bool is_adjacent(const Opm::GridDims& gridDims,
         || is_adjacent(ijk1, ijk2, {2, 0, 1}); // (I,J,K) <-> (I,J,K+1)
 }
 
+std::uint64_t region_pair_key(const int regionId1, const int regionId2)
+{
+    return (std::uint64_t{static_cast<std::uint32_t>(regionId1)} << 32)
+        | static_cast<std::uint32_t>(regionId2);
+}
+
+std::size_t region_pair_hash(const std::uint64_t key)
+{
+    auto hash = key * 0x9e3779b97f4a7c15ULL;
+    return static_cast<std::size_t>(hash ^ (hash >> 32));
+}
+
 } // Anonymous namespace
 
 namespace Opm {
@@ -111,6 +124,94 @@ namespace Opm {
 
     // -----------------------------------------------------------------------
 
+    // Dense tables are used as long as they are not excessively large or
+    // sparse; with very many regions the lookup falls back to hashing.
+    void MULTREGTScanner::RegionPairTable::build(const MULTREGTSearchMap& searchMap)
+    {
+        this->dense.clear();
+        this->slots.clear();
+        this->num_regions = 0;
+
+        if (searchMap.empty()) {
+            return;
+        }
+
+        auto min_reg = searchMap.begin()->first.first;
+        auto max_reg = min_reg;
+        for (const auto& [regPair, recordIx] : searchMap) {
+            min_reg = std::min({ min_reg, regPair.first, regPair.second });
+            max_reg = std::max({ max_reg, regPair.first, regPair.second });
+        }
+
+        const auto num_reg = static_cast<std::size_t>(max_reg - min_reg) + 1;
+        const auto dense_limit = std::min(std::size_t{1} << 22,
+                                          std::max(std::size_t{1} << 16, 64 * searchMap.size()));
+
+        if (num_reg * num_reg <= dense_limit) {
+            this->min_region = min_reg;
+            this->num_regions = num_reg;
+            this->dense.assign(num_reg * num_reg, -1);
+
+            for (const auto& [regPair, recordIx] : searchMap) {
+                const auto r1 = static_cast<std::size_t>(regPair.first - min_reg);
+                const auto r2 = static_cast<std::size_t>(regPair.second - min_reg);
+                this->dense[r1*num_reg + r2] = static_cast<int>(recordIx);
+            }
+
+            return;
+        }
+
+        auto capacity = std::size_t{8};
+        while (capacity < 2 * searchMap.size()) {
+            capacity *= 2;
+        }
+
+        this->slots.assign(capacity, { std::uint64_t{0}, -1 });
+        const auto mask = capacity - 1;
+        for (const auto& [regPair, recordIx] : searchMap) {
+            const auto key = region_pair_key(regPair.first, regPair.second);
+            auto slot = region_pair_hash(key) & mask;
+            while (this->slots[slot].second >= 0) {
+                slot = (slot + 1) & mask;
+            }
+
+            this->slots[slot] = { key, static_cast<int>(recordIx) };
+        }
+    }
+
+    int MULTREGTScanner::RegionPairTable::find(const int regionId1, const int regionId2) const
+    {
+        if (! this->dense.empty()) {
+            const auto r1 = static_cast<std::size_t>(regionId1 - this->min_region);
+            const auto r2 = static_cast<std::size_t>(regionId2 - this->min_region);
+            if ((regionId1 < this->min_region) || (regionId2 < this->min_region) ||
+                (r1 >= this->num_regions) || (r2 >= this->num_regions))
+            {
+                return -1;
+            }
+
+            return this->dense[r1*this->num_regions + r2];
+        }
+
+        if (this->slots.empty()) {
+            return -1;
+        }
+
+        const auto key = region_pair_key(regionId1, regionId2);
+        const auto mask = this->slots.size() - 1;
+        for (auto slot = region_pair_hash(key) & mask; this->slots[slot].second >= 0;
+             slot = (slot + 1) & mask)
+        {
+            if (this->slots[slot].first == key) {
+                return this->slots[slot].second;
+            }
+        }
+
+        return -1;
+    }
+
+    // -----------------------------------------------------------------------
+
     // Later records with the same region IDs overwrite earlier.  As an
     // example, in the MULTREGT keyword
     //
@@ -154,6 +255,8 @@ namespace Opm {
 
         this->template fillSearchMap<0>(m_records);
         this->template fillSearchMap<1>(m_records_same);
+
+        this->buildRegionTables();
     }
 
     template<int index>
@@ -191,6 +294,37 @@ namespace Opm {
         }
     }
 
+    const std::vector<int>& MULTREGTScanner::RegionTable::regionData() const
+    {
+        if (this->region_data == nullptr) {
+            throw std::out_of_range {
+                "MULTREGT region array " + this->region_name + " is not available"
+            };
+        }
+
+        return *this->region_data;
+    }
+
+    void MULTREGTScanner::buildRegionTables()
+    {
+        this->m_regionTables.clear();
+        this->m_regionTables.reserve(this->m_searchMap.size());
+
+        for (const auto& [regName, regMaps] : this->m_searchMap) {
+            auto& table = this->m_regionTables.emplace_back();
+            table.region_name = regName;
+
+            // A missing region array is reported when the table is used.
+            auto regionPos = this->regions.find(regName);
+            if (regionPos != this->regions.end()) {
+                table.region_data = &regionPos->second;
+            }
+
+            table.different.build(std::get<0>(regMaps));
+            table.same.build(std::get<1>(regMaps));
+        }
+    }
+
     MULTREGTScanner::MULTREGTScanner(const MULTREGTScanner& rhs)
     {
         *this = rhs;
@@ -237,6 +371,8 @@ namespace Opm {
         this->regions = data.regions;
         this->aquifer_cells = data.aquifer_cells;
 
+        this->buildRegionTables();
+
         return *this;
     }
 
@@ -274,6 +410,74 @@ namespace Opm {
     double MULTREGTScanner::getRegionMultiplier(const std::size_t globalIndex1,
                                                 const std::size_t globalIndex2,
                                                 const FaceDir::DirEnum faceDir) const
+    {
+        if (this->m_regionTables.empty()) {
+            return 1.0;
+        }
+
+        return this->regionMultiplier(globalIndex1, globalIndex2, faceDir,
+                                      is_adjacent(this->gridDims, globalIndex1, globalIndex2));
+    }
+
+    void MULTREGTScanner::applyRegionMultipliers(const FaceDir::DirEnum faceDir,
+                                                 std::vector<double>& multipliers) const
+    {
+        const auto nx = this->gridDims.getNX();
+        const auto ny = this->gridDims.getNY();
+        const auto nz = this->gridDims.getNZ();
+        const auto num_cells = nx * ny * nz;
+
+        if (multipliers.size() != num_cells) {
+            throw std::invalid_argument {
+                "Size mismatch when applying MULTREGT multipliers: got "
+                + std::to_string(multipliers.size()) + " values, expected "
+                + std::to_string(num_cells)
+            };
+        }
+
+        if (this->m_regionTables.empty()) {
+            return;
+        }
+
+        // Component of (i,j,k) to check against the grid boundary, stride
+        // of that component in the global index and +1/-1 for the Plus and
+        // Minus directions respectively.
+        std::size_t comp = 0, stride = 1;
+        bool plus = true;
+        switch (faceDir) {
+        case FaceDir::XPlus:  comp = 0; stride = 1;       plus = true;  break;
+        case FaceDir::XMinus: comp = 0; stride = 1;       plus = false; break;
+        case FaceDir::YPlus:  comp = 1; stride = nx;      plus = true;  break;
+        case FaceDir::YMinus: comp = 1; stride = nx;      plus = false; break;
+        case FaceDir::ZPlus:  comp = 2; stride = nx * ny; plus = true;  break;
+        case FaceDir::ZMinus: comp = 2; stride = nx * ny; plus = false; break;
+        default:
+            throw std::invalid_argument {
+                "Unsupported face direction when applying MULTREGT multipliers"
+            };
+        }
+
+        const std::array<std::size_t, 3> dims { nx, ny, nz };
+
+        #pragma omp parallel for schedule(static)
+        for (std::size_t globalIndex = 0; globalIndex < num_cells; ++globalIndex) {
+            const std::array<std::size_t, 3> ijk {
+                globalIndex % nx, (globalIndex / nx) % ny, globalIndex / (nx * ny)
+            };
+
+            if (plus ? (ijk[comp] + 1 >= dims[comp]) : (ijk[comp] == 0)) {
+                continue;
+            }
+
+            const auto neighbour = plus ? globalIndex + stride : globalIndex - stride;
+            multipliers[globalIndex] *= this->regionMultiplier(globalIndex, neighbour, faceDir, true);
+        }
+    }
+
+    double MULTREGTScanner::regionMultiplier(const std::size_t globalIndex1,
+                                             const std::size_t globalIndex2,
+                                             const FaceDir::DirEnum faceDir,
+                                             const bool is_adj) const
     {
         // If multiple records, from different region sets and region
         // IDs--e.g., both regions 1/2 in 'M' (MULTNUM) and regions 2/3 in
@@ -281,24 +485,13 @@ namespace Opm {
         // multiplier value is the product of the values from each record.
         auto multiplier = 1.0;
 
-        if (this->m_searchMap.empty()) {
-            return multiplier;
-        }
-
-        auto regPairFoundDifferent = [faceDir, this](const auto& regMap, const auto& regPairPos)
+        auto regPairFound = [faceDir](const MULTREGTRecord& record)
         {
-            return (regPairPos != regMap.end())
-                && ((this->m_records[regPairPos->second].directions & faceDir) != 0);
-        };
-
-        auto regPairFoundSame = [faceDir, this](const auto& regMap, const auto& regPairPos)
-        {
-            return (regPairPos != regMap.end())
-                && ((this->m_records_same[regPairPos->second].directions & faceDir) != 0);
+            return (record.directions & faceDir) != 0;
         };
 
         auto ignoreMultiplierRecord =
-            [is_adj = is_adjacent(this->gridDims, globalIndex1, globalIndex2),
+            [is_adj,
              is_aqu = this->isAquNNC(globalIndex1, globalIndex2)]
             (const MULTREGT::NNCBehaviourEnum nnc_behaviour)
         {
@@ -313,9 +506,14 @@ namespace Opm {
                 || (is_aqu              && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC));
         };
 
+        const auto applyMultiplier = [ignoreMultiplierRecord](const MULTREGTRecord& record)
+        {
+            return (record.nnc_behaviour == MULTREGT::NNCBehaviourEnum::ALL) ||
+            ! ignoreMultiplierRecord(record.nnc_behaviour);
+        };
 
-        for (const auto& [regName, regMaps] : this->m_searchMap) {
-            const auto& region_data = this->regions.at(regName);
+        for (const auto& regTable : this->m_regionTables) {
+            const auto& region_data = regTable.regionData();
 
             auto regionId1 = region_data[globalIndex1];
             auto regionId2 = region_data[globalIndex2];
@@ -324,28 +522,22 @@ namespace Opm {
                 std::swap(regionId1, regionId2);
             }
 
-            const auto applyMultiplier = [ignoreMultiplierRecord](const MULTREGTRecord& record)
-            {
-                return (record.nnc_behaviour == MULTREGT::NNCBehaviourEnum::ALL) ||
-                ! ignoreMultiplierRecord(record.nnc_behaviour);
-            };
-
-            multiplier = this->template applyMultiplierDifferentRegion(regMaps,
+            multiplier = this->template applyMultiplierDifferentRegion(regTable,
                                                                        multiplier,
                                                                        regionId1,
                                                                        regionId2,
                                                                        applyMultiplier,
-                                                                       regPairFoundDifferent);
+                                                                       regPairFound);
             // same region. Note that a pair where both region indices are the same is special.
             // For connections between it and all other regions the multipliers
             // will not override otherwise explicitly specified (as pairs with
             // different ids) multipliers, but accumulated to these.
-            multiplier = this->template applyMultiplierSameRegion(regMaps,
+            multiplier = this->template applyMultiplierSameRegion(regTable,
                                                                   multiplier,
                                                                   regionId1,
                                                                   regionId2,
                                                                   applyMultiplier,
-                                                                  regPairFoundSame);
+                                                                  regPairFound);
         }
 
         return multiplier;
@@ -360,7 +552,7 @@ namespace Opm {
         // multiplier value is the product of the values from each record.
         auto multiplier = 1.0;
 
-        if (this->m_searchMap.empty()) {
+        if (this->m_regionTables.empty()) {
             return multiplier;
         }
 
@@ -372,8 +564,8 @@ namespace Opm {
                 || (is_aqu && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC));
         };
 
-        for (const auto& [regName, regMaps] : this->m_searchMap) {
-            const auto& region_data = this->regions.at(regName);
+        for (const auto& regTable : this->m_regionTables) {
+            const auto& region_data = regTable.regionData();
 
             auto regionId1 = region_data[globalCellIdx1];
             auto regionId2 = region_data[globalCellIdx2];
@@ -386,13 +578,13 @@ namespace Opm {
                 return ! ignoreMultiplierRecord(record.nnc_behaviour);
             };
 
-            const auto regPairFound = [](const auto& regMap, const auto& regPairPos)
+            const auto regPairFound = [](const auto&)
             {
                 // all entries match no matter what FaceDir says.
-                return (regPairPos != regMap.end());
+                return true;
             };
 
-            multiplier = this->template applyMultiplierSameRegion(regMaps,
+            multiplier = this->template applyMultiplierSameRegion(regTable,
                                                                   multiplier,
                                                                   regionId1,
                                                                   regionId2,
@@ -402,7 +594,7 @@ namespace Opm {
             // For connections between it and all other regions the multipliers
             // will not override otherwise explicitly specified (as pairs with
             // different ids) multipliers, but accumulated to these.
-            multiplier = this->template applyMultiplierDifferentRegion(regMaps,
+            multiplier = this->template applyMultiplierDifferentRegion(regTable,
                                                                        multiplier,
                                                                        regionId1,
                                                                        regionId2,
@@ -414,25 +606,22 @@ namespace Opm {
     }
 
     template<typename ApplyDecision, typename RegPairFound>
-    double MULTREGTScanner::applyMultiplierDifferentRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
+    double MULTREGTScanner::applyMultiplierDifferentRegion(const RegionTable& regTable,
                                                            double multiplier,
-                                                           std::size_t regionId1,
-                                                           std::size_t regionId2,
+                                                           int regionId1,
+                                                           int regionId2,
                                                            const ApplyDecision& applyMultiplier,
                                                            const RegPairFound& regPairFound) const
     {
-        const auto& myMap = std::get<0>(regMaps);
-        decltype(myMap.begin()) regPairPos;
-
-        regPairPos = myMap.find({ regionId1, regionId2 });
+        const auto recordIx = regTable.different.find(regionId1, regionId2);
 
-        if (!regPairFound(myMap, regPairPos)) {
+        if (recordIx < 0) {
             // Pair not found.
             return multiplier;
         }
-        const auto& record = this->m_records[regPairPos->second];
+        const auto& record = this->m_records[recordIx];
 
-        if (applyMultiplier(record)) {
+        if (regPairFound(record) && applyMultiplier(record)) {
             multiplier *= record.trans_mult;
         }
 
@@ -441,36 +630,33 @@ namespace Opm {
 
 
     template<typename ApplyDecision, typename RegPairFound>
-    double MULTREGTScanner::applyMultiplierSameRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
+    double MULTREGTScanner::applyMultiplierSameRegion(const RegionTable& regTable,
                                                       double multiplier,
-                                                      std::size_t regionId1,
-                                                      std::size_t regionId2,
+                                                      int regionId1,
+                                                      int regionId2,
                                                       const ApplyDecision& applyMultiplier,
                                                       const RegPairFound& regPairFound) const
     {
-        const auto& myMap = std::get<1>(regMaps);
-        decltype(myMap.begin()) regPairPos;
-
         // search for entry where the two region ids are the same
         // where one of those is a region of ours.
-        regPairPos = myMap.find({ regionId1, regionId1 });
+        auto recordIx = regTable.same.find(regionId1, regionId1);
 
-        if (regPairFound(myMap, regPairPos)) {
-            const auto& record = this->m_records_same[regPairPos->second];
+        if (recordIx >= 0) {
+            const auto& record = this->m_records_same[recordIx];
 
-            if (applyMultiplier(record)) {
+            if (regPairFound(record) && applyMultiplier(record)) {
                 multiplier *= record.trans_mult;
             }
         }
         if (regionId1 != regionId2)
         {
             // also try to apply other region multiplier.
-            regPairPos = myMap.find({ regionId2, regionId2 });
+            recordIx = regTable.same.find(regionId2, regionId2);
 
-            if (regPairFound(myMap, regPairPos)) {
-                const auto& record = this->m_records_same[regPairPos->second];
+            if (recordIx >= 0) {
+                const auto& record = this->m_records_same[recordIx];
 
-                if (applyMultiplier(record)) {
+                if (regPairFound(record) && applyMultiplier(record)) {
                     multiplier *= record.trans_mult;
                 }
             }
@@ -25,6 +25,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <string>
@@ -109,6 +110,17 @@ namespace Opm {
         double getRegionMultiplierNNC(std::size_t globalCellIdx1,
                                       std::size_t globalCellIdx2) const;
 
+        /// \brief Apply region multipliers to all faces in one direction
+        ///
+        /// Multiplies multipliers[g] by getRegionMultiplier(g, n, faceDir)
+        /// for every global cell g which has a neighbour n in direction
+        /// faceDir.  Faces on the grid boundary are left unchanged.
+        ///
+        /// \param faceDir Face direction.
+        /// \param multipliers Face multipliers, one per global cell.
+        void applyRegionMultipliers(FaceDir::DirEnum faceDir,
+                                    std::vector<double>& multipliers) const;
+
         template <class Serializer>
         void serializeOp(Serializer& serializer)
         {
@@ -120,6 +132,10 @@ namespace Opm {
 
             serializer(regions);
             serializer(aquifer_cells);
+
+            if (!serializer.isSerializing()) {
+                this->buildRegionTables();
+            }
         }
 
     private:
@@ -130,20 +146,51 @@ namespace Opm {
             std::vector<MULTREGTRecord>::size_type
         >;
 
+        /// \brief Record index lookup on region pairs
+        ///
+        /// Dense (region1, region2) table over the range of region IDs
+        /// in use, or an open addressing hash table if that range is too
+        /// large for a dense table.
+        class RegionPairTable
+        {
+        public:
+            void build(const MULTREGTSearchMap& searchMap);
+
+            /// Index of the record for the pair, or -1 if there is none.
+            int find(int regionId1, int regionId2) const;
+
+        private:
+            int min_region{0};
+            std::size_t num_regions{0};
+            std::vector<int> dense{};
+            std::vector<std::pair<std::uint64_t, int>> slots{};
+        };
+
+        /// \brief Precompiled lookup tables for one region set.
+        struct RegionTable
+        {
+            std::string region_name{};
+            const std::vector<int>* region_data{nullptr};
+            RegionPairTable different{};
+            RegionPairTable same{};
+
+            /// \brief Region array; throws std::out_of_range if the
+            /// region set has not been loaded.
+            const std::vector<int>& regionData() const;
+        };
+
         /// \brief Apply regionMultiplier from entries where source and target region differ
         ///
-        /// \param regMaps the maps for the region name (FLUXNUM or else)
-        ///        first entry is between regions with different indices
-        ///        second entry is between regions withe the same index
+        /// \param regTable the lookup tables for the region name (FLUXNUM or else)
         /// \param regionId1 Id of egion for first cell
         /// \param regionId Id of regions for the second cell (not less than regionId1!)
         /// \param applyMultiplier Functor returning true if multiplier should be applied
-        /// \param regPairFound Functor to check whether there is a entry for region pair.
+        /// \param regPairFound Functor to check whether the record found for the region pair applies.
         template<typename ApplyDecision, typename RegPairFound>
-        double applyMultiplierDifferentRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
+        double applyMultiplierDifferentRegion(const RegionTable& regTable,
                                               double multiplier,
-                                              std::size_t regionId1,
-                                              std::size_t regionId2,
+                                              int regionId1,
+                                              int regionId2,
                                               const ApplyDecision& applyMultiplier,
                                               const RegPairFound& regPairFound) const;
 
@@ -153,23 +200,28 @@ namespace Opm {
         /// For connections between it and all other regions the multipliers
         /// will not override otherwise explicitly specified (as pairs with
         /// different ids) multipliers, but accumulated to these.
-        /// \param regMaps the maps for the region name (FLUXNUM or else)
-        ///        first entry is between regions with different indices
-        ///        second entry is between regions withe the same index
+        /// \param regTable the lookup tables for the region name (FLUXNUM or else)
         /// \param regionId1 Id of egion for first cell
         /// \param regionId Id of regions for the second cell (not less than regionId1!)
         /// \param applyMultiplier Functor returning true if multiplier should be applied
-        /// \param regPairFound Functor to check whether there is a entry for region pair.
+        /// \param regPairFound Functor to check whether the record found for the region pair applies.
         template<typename ApplyDecision, typename RegPairFound>
-        double applyMultiplierSameRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
+        double applyMultiplierSameRegion(const RegionTable& regTable,
                                          double multiplier,
-                                         std::size_t regionId1,
-                                         std::size_t regionId2,
+                                         int regionId1,
+                                         int regionId2,
                                          const ApplyDecision& applyMultiplier,
                                          const RegPairFound& regPairFound) const;
         template<int index>
         void fillSearchMap(const std::vector<MULTREGTRecord>& records);
 
+        void buildRegionTables();
+
+        double regionMultiplier(std::size_t globalIndex1,
+                                std::size_t globalIndex2,
+                                FaceDir::DirEnum faceDir,
+                                bool is_adj) const;
+
         GridDims gridDims{};
         const FieldPropsManager* fp{nullptr};
 
@@ -187,6 +239,9 @@ namespace Opm {
         std::map<std::string, std::vector<int>> regions{};
         std::vector<std::size_t> aquifer_cells{};
 
+        // Derived from m_searchMap and regions, not serialized.
+        std::vector<RegionTable> m_regionTables{};
+
         void addKeyword(const DeckKeyword& deckKeyword);
 
         bool isAquNNC(std::size_t globalCellIdx1, std::size_t globalCellIdx2) const;
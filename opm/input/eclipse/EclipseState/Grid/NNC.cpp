@@ -17,10 +17,9 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
-#include <array>
-#include <deque>
-#include <cstddef>
 #include <algorithm>
+#include <cstddef>
+#include <vector>
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Deck/DeckItem.hpp>
@@ -114,7 +113,8 @@ bool is_neighbor(const EclipseGrid& grid, std::size_t g1, std::size_t g2) {
                 this->m_nnc_location = keyword_ptr->location();
         }
 
-        std::sort(this->m_input.begin(), this->m_input.end());
+        // Stable, to keep NNCs between the same cells in the deck order.
+        std::stable_sort(this->m_input.begin(), this->m_input.end());
     }
 
 
@@ -141,52 +141,52 @@ bool is_neighbor(const EclipseGrid& grid, std::size_t g1, std::size_t g2) {
                 this->m_edit_location = keyword_ptr->location();
         }
 
-        std::sort(nnc_edit.begin(), nnc_edit.end());
+        std::stable_sort(nnc_edit.begin(), nnc_edit.end());
+
+        // Group the edits by cell pair. Distinct pairs touch disjoint ranges
+        // of the sorted m_input, and the groups can be applied independently.
+        std::vector<std::size_t> group_start;
+        for (std::size_t index = 0; index < nnc_edit.size(); ++index) {
+            if (index == 0 || nnc_edit[index - 1] < nnc_edit[index])
+                group_start.push_back(index);
+        }
+        group_start.push_back(nnc_edit.size());
 
         // If we have a corresponding NNC already, then we apply
         // the multiplier from EDITNNC to it. Otherwise we internalize
         // it into m_edit
-        auto current_input = this->m_input.begin();
-        for (const auto& current_edit : nnc_edit) {
-            if (current_input == this->m_input.end()) {
-                this->add_edit(current_edit);
+        const std::size_t num_groups = group_start.size() - 1;
+        std::vector<char> applied(num_groups, 0);
+
+        #pragma omp parallel for schedule(static)
+        for (std::size_t group = 0; group < num_groups; ++group) {
+            const auto& key = nnc_edit[group_start[group]];
+            const auto [first, last] = std::equal_range(this->m_input.begin(),
+                                                        this->m_input.end(), key);
+            if (first == last)
                 continue;
-            }
-
-            if (current_input->cell1 != current_edit.cell1 || current_input->cell2 != current_edit.cell2) {
-                current_input = std::lower_bound(this->m_input.begin(),
-                                                 this->m_input.end(),
-                                                 NNCdata(current_edit.cell1, current_edit.cell2, 0));
-                if (current_input == this->m_input.end()) {
-                    this->add_edit(current_edit);
-                    continue;
-                }
 
+            for (auto edit = group_start[group]; edit < group_start[group + 1]; ++edit) {
+                std::for_each(first, last, [tran_mult = nnc_edit[edit].trans](NNCdata& nnc)
+                {
+                    nnc.trans *= tran_mult;
+                });
             }
 
-            bool edit_processed = false;
-            while (current_input != this->m_input.end()
-                   && current_input->cell1 == current_edit.cell1
-                   && current_input->cell2 == current_edit.cell2)
-            {
-                current_input->trans *= current_edit.trans;
-                ++current_input;
-                edit_processed = true;
-            }
+            applied[group] = 1;
+        }
+
+        for (std::size_t group = 0; group < num_groups; ++group) {
+            if (applied[group])
+                continue;
 
-            if (!edit_processed)
-                this->add_edit(current_edit);
+            for (auto edit = group_start[group]; edit < group_start[group + 1]; ++edit)
+                this->add_edit(nnc_edit[edit]);
         }
     }
 
     void NNC::load_editr(const EclipseGrid& grid, const Deck& deck) {
-        // Will contain EDITNNCR data in reverse order to be able
-        // use unique to only keep the last one from the data file.
-        // For that we stable_sort it later. This sort is stable and hence
-        // entries for the cell pairs will be consecutive and the last
-        // entry that was specified in the data file will come first and
-        // will kept by std::unique.
-        std::deque<NNCdata> nnc_editr;
+        std::vector<NNCdata> nnc_editr;
 
         const auto& keyword_list = deck.getKeywordList<ParserKeywords::EDITNNCR>();
 
@@ -194,7 +194,7 @@ bool is_neighbor(const EclipseGrid& grid, std::size_t g1, std::size_t g2) {
             return;
         }
 
-        for (const auto& keyword_ptr : deck.getKeywordList<ParserKeywords::EDITNNCR>()) {
+        for (const auto& keyword_ptr : keyword_list) {
             const auto& records = *keyword_ptr;
             if (records.empty()) {
                 continue;
@@ -209,7 +209,7 @@ bool is_neighbor(const EclipseGrid& grid, std::size_t g1, std::size_t g2) {
                     continue;
 
                 double trans = record.getItem(6).getSIDouble(0);
-                nnc_editr.emplace_front(g1, g2, trans);
+                nnc_editr.emplace_back(g1, g2, trans);
             }
 
             if (!this->m_editr_location)
@@ -220,20 +220,18 @@ bool is_neighbor(const EclipseGrid& grid, std::size_t g1, std::size_t g2) {
             return;
         }
 
-        // Sort the deck to make entries for the same cell pair consecutive.
-        // Will keep the insertion order of entries for same cell pair as sort
-        // is stable.
+        // Sort to make entries for the same cell pair consecutive. The sort
+        // is stable, hence the last entry of each run is the one specified
+        // last in the data file, and that is the one we keep.
         std::stable_sort(nnc_editr.begin(), nnc_editr.end());
 
-        // remove duplicates (based on only cell1 and cell2 members)
-        // recall that entries for the same cell pairs are consecutive after
-        // the stable_sort above, and that the last entry specified in the data file
-        // comes first in the deck (because we used emplace_front, and sort is stable)
-        auto equality = [](const NNCdata& d1, const NNCdata& d2){
-            return d1.cell1 == d2.cell1 && d1.cell2 == d2.cell2;
-        };
-        auto new_end = std::unique(nnc_editr.begin(), nnc_editr.end(), equality);
-        nnc_editr.erase(new_end, nnc_editr.end());
+        auto keep = nnc_editr.begin();
+        for (auto run = nnc_editr.begin(); run != nnc_editr.end();) {
+            auto next = std::upper_bound(run, nnc_editr.end(), *run);
+            *keep++ = *(next - 1);
+            run = next;
+        }
+        nnc_editr.erase(keep, nnc_editr.end());
 
         // Remove corresponding EDITNNC entries in m_edit as EDITNNCR
         // will overwrite transmissibilities anyway
@@ -249,7 +247,6 @@ bool is_neighbor(const EclipseGrid& grid, std::size_t g1, std::size_t g2) {
         // in the simulator by EDITNNCR, anyway.
 
         // Create new container to not use excess memory
-        // and convert to std::vector
         m_editr.assign(nnc_editr.begin(), nnc_editr.end());
     }
 
@@ -270,12 +267,20 @@ bool is_neighbor(const EclipseGrid& grid, std::size_t g1, std::size_t g2) {
             return this->addNNC(cell2, cell1, trans);
 
         auto nnc = NNCdata(cell1, cell2, trans);
-        auto insert_iter = std::lower_bound(this->m_input.begin(), this->m_input.end(), nnc);
+        if (this->m_input.empty() || !(nnc < this->m_input.back())) {
+            this->m_input.push_back(nnc);
+            return true;
+        }
+
+        auto insert_iter = std::upper_bound(this->m_input.begin(), this->m_input.end(), nnc);
         this->m_input.insert( insert_iter, nnc);
         return true;
     }
 
     void NNC::merge(const std::vector<NNCdata>& data) {
+        if (data.empty())
+            return;
+
         auto old_size = m_input.size();
         m_input.insert(m_input.end(), data.begin(), data.end());
 
@@ -283,7 +288,7 @@ bool is_neighbor(const EclipseGrid& grid, std::size_t g1, std::size_t g2) {
             if (item.cell1 > item.cell2)
                 std::swap(item.cell1, item.cell2);
         });
-        std::sort(m_input.begin() + old_size, m_input.end());
+        std::stable_sort(m_input.begin() + old_size, m_input.end());
         std::inplace_merge(m_input.begin(), m_input.begin() + old_size, m_input.end());
     }
 
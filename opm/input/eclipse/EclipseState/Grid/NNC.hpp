@@ -91,6 +91,12 @@ class EclipseGrid;
     1. For all NNC / EDITNNC records we will have cell1 <= cell2
     2. The vectors NNC::input() and NNC::edit() will be ordered in ascending
        order.
+    3. Multiple NNCs between the same pair of cells are kept in the order
+       they were added.
+
+  Large sets of NNCs, e.g. from numerical aquifers or LGRs, should be added
+  in bulk with merge() rather than one at a time with addNNC(); the latter is
+  only cheap when the NNCs are added in ascending order.
 
   While constructing from a deck NNCs connected to inactive cells will be
   silently ignored. Do observe though that the addNNC() function does not check
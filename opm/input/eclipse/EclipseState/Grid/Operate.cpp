@@ -106,29 +106,34 @@ namespace {
     }
 
     using func4 = decltype(&MULTA);
-    static const std::map<std::string, func4> operations = {{"MULTA", &MULTA},
-                                                            {"POLY", &POLY},
-                                                            {"SLOG", &SLOG},
-                                                            {"LOG10", &LOG10},
-                                                            {"LOGE", &LOGE},
-                                                            {"INV", &INV},
-                                                            {"MULTX", &MULTX},
-                                                            {"ADDX", &ADDX},
-                                                            {"COPY", &COPY},
-                                                            {"MAXLIM", &MAXLIM},
-                                                            {"MINLIM", &MINLIM},
-                                                            {"MULTP", &MULTP},
-                                                            {"ABS", &ABS},
-                                                            {"MULTIPLY", &MULTIPLY}};
-}
 
-function get(const std::string& func, double alpha, double beta) {
-    auto inner_func = operations.at(func);
+    // The element function is a template argument, i.e. it is inlined into
+    // the loop and the compiler is free to vectorise it.
+    template <func4 F>
+    void bulk(double* R, const double* X, const std::size_t n, const double alpha, const double beta)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            R[i] = F(R[i], X[i], alpha, beta);
+    }
+
+    static const std::map<std::string, kernel> operations = {{"MULTA", &bulk<&MULTA>},
+                                                             {"POLY", &bulk<&POLY>},
+                                                             {"SLOG", &bulk<&SLOG>},
+                                                             {"LOG10", &bulk<&LOG10>},
+                                                             {"LOGE", &bulk<&LOGE>},
+                                                             {"INV", &bulk<&INV>},
+                                                             {"MULTX", &bulk<&MULTX>},
+                                                             {"ADDX", &bulk<&ADDX>},
+                                                             {"COPY", &bulk<&COPY>},
+                                                             {"MAXLIM", &bulk<&MAXLIM>},
+                                                             {"MINLIM", &bulk<&MINLIM>},
+                                                             {"MULTP", &bulk<&MULTP>},
+                                                             {"ABS", &bulk<&ABS>},
+                                                             {"MULTIPLY", &bulk<&MULTIPLY>}};
+}
 
-    return [alpha, beta, inner_func](double R, double X)
-           {
-               return inner_func(R,X,alpha,beta);
-           };
+kernel get(const std::string& func) {
+    return operations.at(func);
 }
 
 }
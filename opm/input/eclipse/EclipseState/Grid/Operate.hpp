@@ -18,16 +18,20 @@
 #ifndef OPERATE_HPP
 #define OPERATE_HPP
 
-#include <functional>
+#include <cstddef>
+#include <string>
 
 
 namespace Opm {
 namespace Operate {
 
-//using operate_fptr = decltype(&MULTA);
-using function = std::function<double(double,double)>;
+/*
+  Bulk version of an OPERATE function; evaluates R[i] = f(R[i], X[i]) for
+  the n consecutive elements starting at R and X.
+*/
+using kernel = void (*)(double* R, const double* X, std::size_t n, double alpha, double beta);
 
-function get(const std::string& func, double alpha, double beta);
+kernel get(const std::string& func);
 
 }
 }
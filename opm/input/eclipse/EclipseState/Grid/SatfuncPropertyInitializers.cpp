@@ -40,6 +40,8 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
 #include <exception>
 #include <functional>
 #include <iterator>
@@ -1427,30 +1429,6 @@ namespace {
         }
     }
 
-    double selectValue(const Opm::TableContainer& depthTables,
-                       int tableIdx,
-                       const std::string& columnName,
-                       double cellDepth,
-                       double fallbackValue,
-                       bool useOneMinusTableValue)
-    {
-        if( tableIdx < 0 ) return fallbackValue;
-
-        const auto& table = depthTables.getTable( tableIdx );
-
-        if( tableIdx >= int( depthTables.size() ) )
-            throw std::invalid_argument("Not enough tables!");
-
-        // evaluate the table at the cell depth
-        const double value = table.evaluate( columnName, cellDepth );
-
-        // a column can be fully defaulted. In this case, eval() returns a NaN
-        // and we have to use the data from saturation tables
-        if( !std::isfinite( value ) ) return fallbackValue;
-        if( useOneMinusTableValue ) return 1 - value;
-        return value;
-    }
-
     void checkSatRegions(const std::size_t  cellIdx,
                          const int          satfunc,
                          const int          endfunc,
@@ -1466,9 +1444,109 @@ namespace {
         }
     }
 
+    /// Depth and value columns of one ENPTVD/IMPTVD table.
+    struct DepthTableColumns
+    {
+        const Opm::TableColumn* depth{nullptr};
+        const Opm::TableColumn* value{nullptr};
+    };
+
+    std::vector<DepthTableColumns>
+    resolveDepthTables(const Opm::TableContainer& depthTables,
+                       const std::string&         columnName,
+                       const int                  numTables)
+    {
+        std::vector<DepthTableColumns> columns(numTables);
+
+        for (int tableIdx = 0; tableIdx < numTables; ++tableIdx) {
+            const auto& table = depthTables.getTable( tableIdx );
+
+            if( tableIdx >= int( depthTables.size() ) )
+                throw std::invalid_argument("Not enough tables!");
+
+            columns[tableIdx].depth = &table.getColumn( 0 );
+            columns[tableIdx].value = &table.getColumn( columnName );
+
+            // Lookup only fails on malformed depth columns; check that here
+            // rather than in the parallel cell loop below.
+            columns[tableIdx].depth->lookup( columns[tableIdx].depth->front() );
+        }
+
+        return columns;
+    }
+
+    // Assign saturation function endpoints to all cells.  The endpoints
+    // are computed once per saturation region by the callers; here they
+    // are gathered into the cells, or replaced by the value of the
+    // depth table of the cell's ENDNUM region if the ENPTVD/IMPTVD tables
+    // are in use.  The depth tables are resolved once per region, such
+    // that the per-cell work is a binary search in the table's depth
+    // column, and the cells are processed in parallel.
+    std::vector<double>
+    regionApply(const std::string&          columnName,
+                const std::vector<double>&  fallbackValues,
+                const Opm::TableContainer&  depthTables,
+                const bool                  useDepthTables,
+                const std::vector<double>&  cell_depth,
+                const std::vector<int>&     regnum_data,
+                const std::vector<int>&     endnum_data,
+                const std::string&          satregname,
+                const bool                  useOneMinusTableValue)
+    {
+        const auto size = cell_depth.size();
+
+        // Active cell better have {SAT,IMB,END}NUM > 0.
+        auto firstInvalid = size;
+        auto maxEndNum = 0;
+#pragma omp parallel for schedule(static) reduction(min:firstInvalid) reduction(max:maxEndNum)
+        for (std::size_t cellIdx = 0; cellIdx < size; ++cellIdx) {
+            if ((regnum_data[cellIdx] < 1) || (endnum_data[cellIdx] < 1)) {
+                firstInvalid = std::min(firstInvalid, cellIdx);
+            }
+
+            maxEndNum = std::max(maxEndNum, endnum_data[cellIdx]);
+        }
+
+        if (firstInvalid < size) {
+            checkSatRegions(firstInvalid,
+                            regnum_data[firstInvalid] - 1,
+                            endnum_data[firstInvalid] - 1,
+                            satregname);
+        }
+
+        const auto depthColumns = useDepthTables
+            ? resolveDepthTables(depthTables, columnName, maxEndNum)
+            : std::vector<DepthTableColumns>{};
+
+        std::vector<double> values(size, 0.0);
+#pragma omp parallel for schedule(static)
+        for (std::size_t cellIdx = 0; cellIdx < size; ++cellIdx) {
+            const auto fallbackValue = fallbackValues[regnum_data[cellIdx] - 1];
+            if (!useDepthTables) {
+                values[cellIdx] = fallbackValue;
+                continue;
+            }
+
+            // evaluate the table at the cell depth
+            const auto& columns = depthColumns[endnum_data[cellIdx] - 1];
+            const double value = columns.value->eval(columns.depth->lookup(cell_depth[cellIdx]));
+
+            // a depth table without a usable value for this column, e.g.
+            // NaN entries, evaluates to a non-finite value. In this case we
+            // have to use the data from saturation tables
+            if (!std::isfinite(value)) {
+                values[cellIdx] = fallbackValue;
+            }
+            else {
+                values[cellIdx] = useOneMinusTableValue ? 1 - value : value;
+            }
+        }
+
+        return values;
+    }
+
     std::vector<double>
-    satnumApply(size_t size,
-                const std::string& columnName,
+    satnumApply(const std::string& columnName,
                 const std::vector< double >& fallbackValues,
                 const Opm::TableManager& tableManager,
                 const std::vector<double>& cell_depth,
@@ -1476,36 +1554,14 @@ namespace {
                 const std::vector<int>& endnum_data,
                 bool useOneMinusTableValue)
     {
-        std::vector< double > values( size, 0 );
-
-        // Actually assign the defaults. If the ENPVD keyword was specified in the deck,
-        // this currently cannot be done because we would need the Z-coordinate of the
-        // cell and we would need to know how the simulator wants to interpolate between
-        // sampling points. Both of these are outside the scope of opm-parser, so we just
-        // assign a NaN in this case...
-        const bool useEnptvd = tableManager.useEnptvd();
-        const auto& enptvdTables = tableManager.getEnptvdTables();
-        for( size_t cellIdx = 0; cellIdx < values.size(); cellIdx++ ) {
-            int satTableIdx = satnum_data[cellIdx] - 1;
-            int endNum = endnum_data[cellIdx] - 1;
-
-            // Active cell better have {SAT,END}NUM > 0.
-            checkSatRegions(cellIdx, satTableIdx, endNum, "SATNUM");
-
-            values[cellIdx] = selectValue(enptvdTables,
-                                          (useEnptvd && endNum >= 0) ? endNum : -1,
-                                          columnName,
-                                          cell_depth[cellIdx],
-                                          fallbackValues[ satTableIdx ],
-                                          useOneMinusTableValue);
-        }
-
-        return values;
+        return regionApply(columnName, fallbackValues,
+                           tableManager.getEnptvdTables(), tableManager.useEnptvd(),
+                           cell_depth, satnum_data, endnum_data,
+                           "SATNUM", useOneMinusTableValue);
     }
 
     std::vector<double>
-    imbnumApply(size_t size,
-                const std::string& columnName,
+    imbnumApply(const std::string& columnName,
                 const std::vector< double >& fallBackValues,
                 const Opm::TableManager& tableManager,
                 const std::vector<double>& cell_depth,
@@ -1513,31 +1569,10 @@ namespace {
                 const std::vector<int>& endnum_data,
                 bool useOneMinusTableValue )
     {
-        std::vector< double > values( size, 0 );
-
-        // Actually assign the defaults. if the ENPVD keyword was specified in the deck,
-        // this currently cannot be done because we would need the Z-coordinate of the
-        // cell and we would need to know how the simulator wants to interpolate between
-        // sampling points. Both of these are outside the scope of opm-parser, so we just
-        // assign a NaN in this case...
-        const bool useImptvd = tableManager.useImptvd();
-        const Opm::TableContainer& imptvdTables = tableManager.getImptvdTables();
-        for( size_t cellIdx = 0; cellIdx < values.size(); cellIdx++ ) {
-            int imbTableIdx = imbnum_data[ cellIdx ] - 1;
-            int endNum = endnum_data[ cellIdx ] - 1;
-
-            // Active cell better have {IMB,END}NUM > 0.
-            checkSatRegions(cellIdx, imbTableIdx, endNum, "IMBNUM");
-
-            values[cellIdx] = selectValue(imptvdTables,
-                                          (useImptvd && endNum >= 0) ? endNum : -1,
-                                          columnName,
-                                          cell_depth[cellIdx],
-                                          fallBackValues[imbTableIdx],
-                                          useOneMinusTableValue);
-        }
-
-        return values;
+        return regionApply(columnName, fallBackValues,
+                           tableManager.getImptvdTables(), tableManager.useImptvd(),
+                           cell_depth, imbnum_data, endnum_data,
+                           "IMBNUM", useOneMinusTableValue);
     }
 
     std::vector<double>
@@ -1548,7 +1583,7 @@ namespace {
                 const std::vector<int>&    satnum,
                 const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SGCO", ep.connate.gas,
+        return satnumApply("SGCO", ep.connate.gas,
                            tableManager, cell_depth, satnum, endnum, false);
     }
 
@@ -1560,7 +1595,7 @@ namespace {
                  const std::vector<int>&    imbnum,
                  const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SGCO", ep.connate.gas,
+        return imbnumApply("SGCO", ep.connate.gas,
                            tableManager, cell_depth, imbnum, endnum, false);
     }
 
@@ -1572,7 +1607,7 @@ namespace {
                 const std::vector<int>&    satnum,
                 const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SGMAX", ep.maximum.gas,
+        return satnumApply("SGMAX", ep.maximum.gas,
                            tableManager, cell_depth, satnum, endnum, false);
     }
 
@@ -1584,7 +1619,7 @@ namespace {
                  const std::vector<int>&    imbnum,
                  const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SGMAX", ep.maximum.gas,
+        return imbnumApply("SGMAX", ep.maximum.gas,
                            tableManager, cell_depth, imbnum, endnum, false);
     }
 
@@ -1596,7 +1631,7 @@ namespace {
                 const std::vector<int>&    satnum,
                 const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SWCO", ep.connate.water,
+        return satnumApply("SWCO", ep.connate.water,
                            tableManager, cell_depth, satnum, endnum, false);
     }
 
@@ -1608,7 +1643,7 @@ namespace {
                  const std::vector<int>&    imbnum,
                  const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SWCO", ep.connate.water,
+        return imbnumApply("SWCO", ep.connate.water,
                            tableManager, cell_depth, imbnum, endnum, false);
     }
 
@@ -1620,7 +1655,7 @@ namespace {
                 const std::vector<int>&    satnum,
                 const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SWMAX", ep.maximum.water,
+        return satnumApply("SWMAX", ep.maximum.water,
                            tableManager, cell_depth, satnum, endnum, true);
     }
 
@@ -1632,7 +1667,7 @@ namespace {
                  const std::vector<int>&    imbnum,
                  const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SWMAX", ep.maximum.water,
+        return imbnumApply("SWMAX", ep.maximum.water,
                            tableManager, cell_depth, imbnum, endnum, true);
     }
 
@@ -1644,7 +1679,7 @@ namespace {
                  const std::vector<int>&    satnum,
                  const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SGCRIT", ep.critical.gas,
+        return satnumApply("SGCRIT", ep.critical.gas,
                            tableManager, cell_depth, satnum, endnum, false);
     }
 
@@ -1656,7 +1691,7 @@ namespace {
                   const std::vector<int>&    imbnum,
                   const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SGCRIT", ep.critical.gas,
+        return imbnumApply("SGCRIT", ep.critical.gas,
                            tableManager, cell_depth, imbnum, endnum, false);
     }
 
@@ -1668,7 +1703,7 @@ namespace {
                   const std::vector<int>&    satnum,
                   const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SOWCRIT", ep.critical.oil_in_water,
+        return satnumApply("SOWCRIT", ep.critical.oil_in_water,
                            tableManager, cell_depth, satnum, endnum, false);
     }
 
@@ -1680,7 +1715,7 @@ namespace {
                    const std::vector<int>&    imbnum,
                    const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SOWCRIT", ep.critical.oil_in_water,
+        return imbnumApply("SOWCRIT", ep.critical.oil_in_water,
                            tableManager, cell_depth, imbnum, endnum, false);
     }
 
@@ -1692,7 +1727,7 @@ namespace {
                   const std::vector<int>&    satnum,
                   const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SOGCRIT", ep.critical.oil_in_gas,
+        return satnumApply("SOGCRIT", ep.critical.oil_in_gas,
                            tableManager, cell_depth, satnum, endnum, false);
     }
 
@@ -1704,7 +1739,7 @@ namespace {
                    const std::vector<int>&    imbnum,
                    const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SOGCRIT", ep.critical.oil_in_gas,
+        return imbnumApply("SOGCRIT", ep.critical.oil_in_gas,
                            tableManager, cell_depth, imbnum, endnum, false);
     }
 
@@ -1716,7 +1751,7 @@ namespace {
                  const std::vector<int>&    satnum,
                  const std::vector<int>&    endnum)
     {
-        return satnumApply(cell_depth.size(), "SWCRIT", ep.critical.water,
+        return satnumApply("SWCRIT", ep.critical.water,
                            tableManager, cell_depth, satnum, endnum, false);
     }
 
@@ -1728,7 +1763,7 @@ namespace {
                   const std::vector<int>&    imbnum,
                   const std::vector<int>&    endnum)
     {
-        return imbnumApply(cell_depth.size(), "SWCRIT", ep.critical.water,
+        return imbnumApply("SWCRIT", ep.critical.water,
                            tableManager, cell_depth, imbnum, endnum, false);
     }
 
@@ -1741,7 +1776,7 @@ namespace {
                 const std::vector<int>&    endnum)
     {
         const auto max_pcow = findMaxPcow(tableManager, phases);
-        return satnumApply(cell_depth.size(), "PCW", max_pcow, tableManager,
+        return satnumApply("PCW", max_pcow, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1754,7 +1789,7 @@ namespace {
                  const std::vector<int>&    endnum)
     {
         const auto max_pcow = findMaxPcow(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IPCW", max_pcow, tableManager,
+        return imbnumApply("IPCW", max_pcow, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 
@@ -1767,7 +1802,7 @@ namespace {
                 const std::vector<int>&    imbnum)
     {
         const auto max_pcog = findMaxPcog(tableManager, phases);
-        return satnumApply(cell_depth.size(), "PCG", max_pcog, tableManager,
+        return satnumApply("PCG", max_pcog, tableManager,
                            cell_depth, satnum, imbnum, false );
     }
 
@@ -1780,7 +1815,7 @@ namespace {
                  const std::vector<int>&    endnum)
     {
         const auto max_pcog = findMaxPcog(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IPCG", max_pcog, tableManager,
+        return imbnumApply("IPCG", max_pcog, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 
@@ -1793,7 +1828,7 @@ namespace {
                 const std::vector<int>&    endnum)
     {
         const auto max_krw = findMaxKrw(tableManager, phases);
-        return satnumApply(cell_depth.size(), "KRW", max_krw, tableManager,
+        return satnumApply("KRW", max_krw, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1806,7 +1841,7 @@ namespace {
                  const std::vector<int>&    endnum)
     {
         const auto max_krw = findMaxKrw(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IKRW", max_krw, tableManager,
+        return imbnumApply("IKRW", max_krw, tableManager,
                            cell_depth, imbnum, endnum, false );
     }
 
@@ -1819,7 +1854,7 @@ namespace {
                  const std::vector<int>&    endnum)
     {
         const auto krwr = findKrwr(tableManager, phases, ep);
-        return satnumApply(cell_depth.size(), "KRWR", krwr, tableManager,
+        return satnumApply("KRWR", krwr, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1832,7 +1867,7 @@ namespace {
                   const std::vector<int>&    endnum)
     {
         const auto krwr = findKrwr(tableManager, phases, ep);
-        return imbnumApply(cell_depth.size(), "IKRWR", krwr, tableManager,
+        return imbnumApply("IKRWR", krwr, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 
@@ -1845,7 +1880,7 @@ namespace {
                 const std::vector<int>&    endnum)
     {
         const auto max_kro = findMaxKro(tableManager, phases);
-        return satnumApply(cell_depth.size(), "KRO", max_kro, tableManager,
+        return satnumApply("KRO", max_kro, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1858,7 +1893,7 @@ namespace {
                  const std::vector<int>&    endnum)
     {
         const auto max_kro = findMaxKro(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IKRO", max_kro, tableManager,
+        return imbnumApply("IKRO", max_kro, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 
@@ -1871,7 +1906,7 @@ namespace {
                   const std::vector<int>&    endnum)
     {
         const auto krorw = findKrorw(tableManager, phases, ep);
-        return satnumApply(cell_depth.size(), "KRORW", krorw, tableManager,
+        return satnumApply("KRORW", krorw, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1884,7 +1919,7 @@ namespace {
                    const std::vector<int>&    endnum)
     {
         const auto krorw = findKrorw(tableManager, phases, ep);
-        return imbnumApply(cell_depth.size(), "IKRORW", krorw, tableManager,
+        return imbnumApply("IKRORW", krorw, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 
@@ -1897,7 +1932,7 @@ namespace {
                   const std::vector<int>&    endnum)
     {
         const auto krorg = findKrorg(tableManager, phases, ep);
-        return satnumApply(cell_depth.size(), "KRORG", krorg, tableManager,
+        return satnumApply("KRORG", krorg, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1910,7 +1945,7 @@ namespace {
                    const std::vector<int>&    endnum)
     {
         const auto krorg = findKrorg(tableManager, phases, ep);
-        return imbnumApply(cell_depth.size(), "IKRORG", krorg, tableManager,
+        return imbnumApply("IKRORG", krorg, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 
@@ -1923,7 +1958,7 @@ namespace {
                 const std::vector<int>&    endnum)
     {
         const auto max_krg = findMaxKrg(tableManager, phases);
-        return satnumApply(cell_depth.size(), "KRG", max_krg, tableManager,
+        return satnumApply("KRG", max_krg, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1936,7 +1971,7 @@ namespace {
                  const std::vector<int>&    endnum)
     {
         const auto max_krg = findMaxKrg(tableManager, phases);
-        return imbnumApply(cell_depth.size(), "IKRG", max_krg, tableManager,
+        return imbnumApply("IKRG", max_krg, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 
@@ -1949,7 +1984,7 @@ namespace {
                  const std::vector<int>&    endnum)
     {
         const auto krgr = findKrgr(tableManager, phases, ep);
-        return satnumApply(cell_depth.size(), "KRGR", krgr, tableManager,
+        return satnumApply("KRGR", krgr, tableManager,
                            cell_depth, satnum, endnum, false);
     }
 
@@ -1962,7 +1997,7 @@ namespace {
                   const std::vector<int>&    endnum)
     {
         const auto krgr = findKrgr(tableManager, phases, ep);
-        return imbnumApply(cell_depth.size(), "IKRGR", krgr, tableManager,
+        return imbnumApply("IKRGR", krgr, tableManager,
                            cell_depth, imbnum, endnum, false);
     }
 } // namespace Anonymous
@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <stdexcept>
 
 #include <fmt/format.h>
@@ -121,6 +122,10 @@ namespace Opm {
         return m_multregtScanner.getRegionMultiplierNNC(globalCellIndex1, globalCellIndex2);
     }
 
+    void TransMult::applyRegionMultipliers(FaceDir::DirEnum faceDir, std::vector<double>& multipliers) const {
+        m_multregtScanner.applyRegionMultipliers(faceDir, multipliers);
+    }
+
     bool TransMult::hasDirectionProperty(FaceDir::DirEnum faceDir) const {
         return m_trans.count(faceDir) == 1;
     }
@@ -135,9 +140,21 @@ namespace Opm {
         return m_trans.at( faceDir );
     }
 
+    const std::vector<double>* TransMult::getMultipliers(FaceDir::DirEnum faceDir) const {
+        auto pos = m_trans.find(faceDir);
+        return (pos != m_trans.end()) ? &pos->second : nullptr;
+    }
+
     void TransMult::applyMULT(const std::vector<double>& srcData, FaceDir::DirEnum faceDir)
     {
         auto& dstProp = this->getDirectionProperty(faceDir);
+
+        // The MULT* arrays are reset to one before the schedule keywords
+        // are applied, so the common case is a no-op.
+        if (std::all_of(srcData.begin(), srcData.end(),
+                        [](const double mult) { return mult == 1.0; }))
+            return;
+
         for (size_t i = 0; i < srcData.size(); ++i)
             dstProp[i] *= srcData[i];
     }
@@ -146,11 +163,10 @@ namespace Opm {
     void TransMult::applyMULTFLT(const Fault& fault) {
         double transMult = fault.getTransMult();
 
-        for( const auto& face : fault ) {
-            FaceDir::DirEnum faceDir = face.getDir();
+        for( const auto& [faceDir, indices] : fault.getFaceIndices() ) {
             auto& multProperty = this->getDirectionProperty(faceDir);
 
-            for( auto globalIndex : face )
+            for( auto globalIndex : indices )
                 multProperty[globalIndex] *= transMult;
         }
     }
@@ -59,8 +59,16 @@ namespace Opm {
 
         double getMultiplier(size_t globalIndex, FaceDir::DirEnum faceDir) const;
         double getMultiplier(size_t i , size_t j , size_t k, FaceDir::DirEnum faceDir) const;
+
+        /// All multipliers in direction \p faceDir, indexed by global cell,
+        /// or nullptr if no multipliers have been applied in that
+        /// direction, in which case they are all equal to one.  The array
+        /// is created as soon as a multiplier keyword or fault refers to
+        /// the direction, so a non-null result may still hold only ones.
+        const std::vector<double>* getMultipliers(FaceDir::DirEnum faceDir) const;
         double getRegionMultiplier( size_t globalCellIndex1, size_t globalCellIndex2, FaceDir::DirEnum faceDir) const;
         double getRegionMultiplierNNC(std::size_t globalCellIndex1, std::size_t globalCellIndex2) const;
+        void applyRegionMultipliers(FaceDir::DirEnum faceDir, std::vector<double>& multipliers) const;
         void applyMULT(const std::vector<double>& srcMultProp, FaceDir::DirEnum faceDir);
         void applyMULTFLT(const FaultCollection& faults);
         void applyMULTFLT(const Fault& fault);
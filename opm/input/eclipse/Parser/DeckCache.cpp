@@ -0,0 +1,450 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/FileSystem.hpp>
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/InputErrorAction.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+
+#include <fmt/format.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Bump whenever the layout of the cache image changes.
+constexpr std::size_t cache_format_version = 2;
+constexpr char cache_magic[8] = {'O','P','M','D','E','C','K','C'};
+
+std::size_t hash_combine(std::size_t seed, std::size_t value)
+{
+    return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+std::size_t hash_content(std::string_view content)
+{
+    return std::hash<std::string_view>{}(content);
+}
+
+std::int64_t modification_time(const fs::path& file, std::error_code& ec)
+{
+    return fs::last_write_time(file, ec).time_since_epoch().count();
+}
+
+bool read_file(const fs::path& file, std::string& buffer)
+{
+    const auto closer = []( std::FILE* f ) { std::fclose( f ); };
+    std::unique_ptr< std::FILE, decltype( closer ) > ufp(
+            std::fopen( file.c_str(), "rb" ),
+            closer
+            );
+
+    if (!ufp)
+        return false;
+
+    auto* fp = ufp.get();
+    std::fseek( fp, 0, SEEK_END );
+    buffer.resize( std::ftell( fp ) );
+    std::rewind( fp );
+    const auto readc = std::fread( buffer.data(), 1, buffer.size(), fp );
+
+    return !std::ferror( fp ) && (readc == buffer.size());
+}
+
+/*
+  The Serializer class keeps its buffer to itself; the cache needs to move
+  the packed image to and from disk.
+*/
+class ImageSerializer : public Opm::Serializer<Opm::Serialization::MemPacker> {
+public:
+    explicit ImageSerializer(const Opm::Serialization::MemPacker& packer)
+        : Opm::Serializer<Opm::Serialization::MemPacker>(packer)
+    {}
+
+    std::vector<char>& buffer() { return this->m_buffer; }
+};
+
+}
+
+namespace Opm {
+
+DeckCache::FileStamp DeckCache::FileStamp::make(const fs::path& file, std::string_view content)
+{
+    std::error_code ec;
+    FileStamp stamp;
+    stamp.path = file.string();
+    stamp.mtime = modification_time(file, ec);
+    stamp.size = content.size();
+    stamp.content_hash = hash_content(content);
+    return stamp;
+}
+
+DeckCache::FileStamp DeckCache::FileStamp::make(const fs::path& file)
+{
+    std::string content;
+    if (!read_file(file, content))
+        throw std::runtime_error(fmt::format("Could not read file {} for deck cache", file.string()));
+
+    return make(file, content);
+}
+
+bool DeckCache::FileStamp::current() const
+{
+    std::error_code ec;
+    const auto file_size = fs::file_size(this->path, ec);
+    if (ec || (file_size != this->size))
+        return false;
+
+    const auto file_mtime = modification_time(this->path, ec);
+    if (ec)
+        return false;
+
+    if (file_mtime == this->mtime)
+        return true;
+
+    // The file has been touched - compare content instead.
+    std::string content;
+    if (!read_file(this->path, content))
+        return false;
+
+    return hash_content(content) == this->content_hash;
+}
+
+bool DeckCache::Segment::current() const
+{
+    return std::all_of(this->files.begin(), this->files.end(),
+                       [](const auto& stamp) { return stamp.current(); });
+}
+
+DeckCache::DeckCache(const fs::path& cache_dir,
+                     const std::string& data_file_arg,
+                     std::size_t parser_hash_arg,
+                     const ParseContext& parseContext,
+                     ErrorGuard& errors_arg)
+    : data_file(data_file_arg)
+    , parser_hash(parser_hash_arg)
+    , parse_context(parseContext)
+    , errors(errors_arg)
+    , warning_mark(errors_arg.warnings().size())
+{
+    const auto root = fs::canonical(data_file_arg).string();
+    this->cache_file = cache_dir / fmt::format("{:016x}.deckcache", std::hash<std::string>{}(root));
+
+    std::string content;
+    if (!fs::exists(this->cache_file) || !read_file(this->cache_file, content))
+        return;
+
+    constexpr auto header_size = sizeof cache_magic + 3*sizeof(std::size_t);
+    if (content.size() < header_size)
+        return;
+
+    if (std::memcmp(content.data(), cache_magic, sizeof cache_magic) != 0)
+        return;
+
+    std::size_t header[3];
+    std::memcpy(header, content.data() + sizeof cache_magic, sizeof header);
+    const auto [version, image_size, image_hash] = header;
+    if (version != cache_format_version || image_size != content.size() - header_size)
+        return;
+
+    const auto image = std::string_view{content}.substr(header_size);
+    if (hash_content(image) != image_hash)
+        return;
+
+    Serialization::MemPacker packer;
+    ImageSerializer ser(packer);
+    ser.buffer().assign(image.begin(), image.end());
+
+    try {
+        Image cached_image;
+        ser.unpack(cached_image);
+        if (cached_image.parser_hash == this->parser_hash)
+            this->cached = std::move(cached_image);
+    }
+    catch (const std::exception& e) {
+        OpmLog::warning(fmt::format("Ignoring unreadable deck cache {}: {}",
+                                    this->cache_file.string(), e.what()));
+    }
+}
+
+std::size_t DeckCache::parserHash(const Parser& parser, const ParseContext& parseContext)
+{
+    auto hash = cache_format_version;
+    for (const auto& name : parser.getAllDeckNames())
+        hash = hash_combine(hash, std::hash<std::string>{}(name));
+
+    for (const auto& [key, action] : parseContext)
+        hash = hash_combine(hash_combine(hash, std::hash<std::string>{}(key)),
+                            static_cast<std::size_t>(action));
+
+    hash = hash_combine(hash, parseContext.isActiveSkipKeyword("SKIP100"));
+    hash = hash_combine(hash, parseContext.isActiveSkipKeyword("SKIP300"));
+    return hash;
+}
+
+std::optional<Deck> DeckCache::loadDeck()
+{
+    if (!this->cached.has_value())
+        return {};
+
+    const auto& image = this->cached.value();
+    if (image.data_file != this->data_file)
+        return {};
+
+    if (!std::all_of(image.files.begin(), image.files.end(),
+                     [](const auto& stamp) { return stamp.current(); }))
+        return {};
+
+    this->replayWarnings(image.warnings);
+    return image.deck;
+}
+
+void DeckCache::collectWarnings()
+{
+    const auto& guard_warnings = this->errors.warnings();
+    for (auto index = this->warning_mark; index < guard_warnings.size(); ++index) {
+        const auto& [key, message] = guard_warnings[index];
+        this->warnings.push_back({key, message});
+        if (this->open_segment.has_value())
+            this->open_segment->warnings.push_back({key, message});
+    }
+
+    this->warning_mark = guard_warnings.size();
+}
+
+void DeckCache::replayWarnings(const std::vector<Warning>& replay)
+{
+    this->collectWarnings();
+    for (const auto& warning : replay) {
+        if (warning.key.empty() || (this->parse_context.get(warning.key) == InputErrorAction::WARN))
+            OpmLog::warning(warning.message);
+
+        if (!warning.key.empty())
+            this->errors.addWarning(warning.key, warning.message);
+
+        this->warnings.push_back(warning);
+    }
+
+    this->warning_mark = this->errors.warnings().size();
+}
+
+void DeckCache::recordWarning(const std::string& message)
+{
+    this->collectWarnings();
+    this->warnings.push_back({"", message});
+    if (this->open_segment.has_value())
+        this->open_segment->warnings.push_back({"", message});
+}
+
+const std::string& DeckCache::rootFile() const
+{
+    if (this->files.empty())
+        throw std::logic_error("Deck cache root file has not been recorded");
+
+    return this->files.front().path;
+}
+
+void DeckCache::recordFile(const fs::path& file, std::string_view content)
+{
+    this->files.push_back(FileStamp::make(file, content));
+    const auto& stamp = this->files.back();
+
+    if (this->files.size() > 1)
+        this->context = hash_combine(this->context, stamp.content_hash);
+
+    if (this->open_segment.has_value())
+        this->open_segment->files.push_back(stamp);
+}
+
+void DeckCache::recordFile(const fs::path& file)
+{
+    std::string content;
+    if (!read_file(file, content)) {
+        this->invalidate();
+        return;
+    }
+
+    this->recordFile(file, content);
+}
+
+std::size_t DeckCache::updateContext(std::string_view root_input)
+{
+    this->context = hash_combine(this->context, hash_content(root_input));
+    return this->context;
+}
+
+bool DeckCache::beginInclude(const std::string& parent_file,
+                             const std::string& include_file,
+                             Deck& deck)
+{
+    this->endInclude(deck.size());
+
+    const Segment* hit = nullptr;
+    if (this->cached.has_value()) {
+        const auto& cached_segments = this->cached->segments;
+        auto iter = std::find_if(cached_segments.begin(), cached_segments.end(),
+                                 [this, &include_file](const auto& segment)
+                                 {
+                                     return (segment.include_file == include_file)
+                                         && (segment.context == this->context)
+                                         && segment.current();
+                                 });
+        if (iter != cached_segments.end())
+            hit = &*iter;
+    }
+
+    if (hit == nullptr) {
+        this->open_segment = Segment{};
+        this->open_segment->include_file = include_file;
+        this->open_segment->context = this->context;
+        this->open_segment->begin = deck.size();
+        this->open_segment_valid = true;
+        return false;
+    }
+
+    Segment segment = *hit;
+    const auto& cached_deck = this->cached->deck;
+
+    auto& deck_tree = deck.tree();
+    deck_tree.add_include(parent_file, include_file);
+    for (const auto& [parent, child] : segment.includes)
+        deck_tree.add_include(parent, child);
+
+    segment.begin = deck.size();
+    for (auto index = hit->begin; index < hit->end; ++index)
+        deck.addKeyword(cached_deck[index]);
+    segment.end = deck.size();
+
+    this->replayWarnings(segment.warnings);
+    for (const auto& stamp : segment.files) {
+        this->files.push_back(stamp);
+        this->context = hash_combine(this->context, stamp.content_hash);
+    }
+
+    this->segments.push_back(std::move(segment));
+    return true;
+}
+
+void DeckCache::endInclude(std::size_t deck_size)
+{
+    this->collectWarnings();
+    if (!this->open_segment.has_value())
+        return;
+
+    if (this->open_segment_valid) {
+        this->open_segment->end = deck_size;
+        this->segments.push_back(std::move(this->open_segment.value()));
+    }
+
+    this->open_segment.reset();
+}
+
+bool DeckCache::insideInclude() const
+{
+    return this->open_segment.has_value();
+}
+
+void DeckCache::recordInclude(const std::string& parent_file, const std::string& include_file)
+{
+    if (this->open_segment.has_value())
+        this->open_segment->includes.emplace_back(parent_file, include_file);
+}
+
+void DeckCache::invalidateInclude()
+{
+    this->open_segment_valid = false;
+}
+
+void DeckCache::invalidate()
+{
+    this->valid = false;
+}
+
+void DeckCache::store(const Deck& deck)
+{
+    this->endInclude(deck.size());
+    if (!this->valid)
+        return;
+
+    Image image;
+    image.parser_hash = this->parser_hash;
+    image.data_file = this->data_file;
+    image.files = this->files;
+    image.segments = this->segments;
+    image.warnings = this->warnings;
+    image.deck = deck;
+
+    try {
+        Serialization::MemPacker packer;
+        ImageSerializer ser(packer);
+        ser.pack(image);
+
+        const auto& buffer = ser.buffer();
+        const std::size_t header[3] = {
+            cache_format_version,
+            buffer.size(),
+            hash_content({buffer.data(), buffer.size()})
+        };
+
+        fs::create_directories(this->cache_file.parent_path());
+
+        // Write to a unique temporary file and rename it into place, so
+        // concurrent jobs never observe a partially written image.
+        auto tmp_file = this->cache_file;
+        tmp_file += unique_path(".%%%%-%%%%");
+        {
+            const auto closer = []( std::FILE* f ) { std::fclose( f ); };
+            std::unique_ptr< std::FILE, decltype( closer ) > ufp(
+                    std::fopen( tmp_file.c_str(), "wb" ),
+                    closer
+                    );
+            if (!ufp)
+                throw std::runtime_error("Could not open " + tmp_file.string());
+
+            auto* fp = ufp.get();
+            std::fwrite(cache_magic, 1, sizeof cache_magic, fp);
+            std::fwrite(header, 1, sizeof header, fp);
+            std::fwrite(buffer.data(), 1, buffer.size(), fp);
+            if (std::ferror(fp))
+                throw std::runtime_error("Could not write " + tmp_file.string());
+        }
+        fs::rename(tmp_file, this->cache_file);
+    }
+    catch (const std::exception& e) {
+        OpmLog::warning(fmt::format("Could not write deck cache {}: {}",
+                                    this->cache_file.string(), e.what()));
+    }
+}
+
+}
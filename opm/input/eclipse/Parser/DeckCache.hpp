@@ -0,0 +1,220 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_DECK_CACHE_HPP
+#define OPM_DECK_CACHE_HPP
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+class ErrorGuard;
+class Parser;
+class ParseContext;
+
+/*
+  The DeckCache class maintains a persistent, binary image of a parsed deck
+  in a cache directory. The image is keyed by the canonical path of the
+  root .DATA file and is only used if the parser configuration matches,
+  and all files which contributed to the deck are unchanged.
+
+  Files are fingerprinted by size and modification time, with a fallback to
+  a hash of the file content when the modification time has changed, i.e.
+  touching a file does not invalidate the cache.
+
+  In addition to the full deck image the cache records one segment per
+  INCLUDE statement in the root file. A segment holds the index range of the
+  keywords originating from that include file (and everything it includes
+  in turn), along with a hash of all the input preceding it. When the full
+  image is stale the parser will still consume the root file, but will
+  splice in the cached keywords from every include file which is unchanged,
+  and which is preceded by unchanged input.
+
+  The warnings issued while parsing are stored along with the keywords, and
+  are issued again - to the log and to the ErrorGuard - when keywords are
+  restored from the cache. Decks with errors are never written to the
+  cache.
+*/
+
+class DeckCache {
+public:
+    struct FileStamp {
+        std::string path;
+        std::int64_t mtime = 0;
+        std::uintmax_t size = 0;
+        std::size_t content_hash = 0;
+
+        static FileStamp make(const std::filesystem::path& file, std::string_view content);
+        static FileStamp make(const std::filesystem::path& file);
+        bool current() const;
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(path);
+            serializer(mtime);
+            serializer(size);
+            serializer(content_hash);
+        }
+    };
+
+    /// Warning issued by the parser.  Warnings with an empty key were
+    /// written directly to the log, the others were reported through the
+    /// ParseContext.
+    struct Warning {
+        std::string key;
+        std::string message;
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(key);
+            serializer(message);
+        }
+    };
+
+    struct Segment {
+        std::string include_file;
+        std::size_t context = 0;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        std::vector<FileStamp> files;
+        std::vector<std::pair<std::string, std::string>> includes;
+        std::vector<Warning> warnings;
+
+        bool current() const;
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(include_file);
+            serializer(context);
+            serializer(begin);
+            serializer(end);
+            serializer(files);
+            serializer(includes);
+            serializer(warnings);
+        }
+    };
+
+    /// Warnings are collected from, and replayed to, \p errors.
+    DeckCache(const std::filesystem::path& cache_dir,
+              const std::string& data_file,
+              std::size_t parser_hash,
+              const ParseContext& parseContext,
+              ErrorGuard& errors);
+
+    /// Hash of everything in the parser configuration which influences
+    /// the parsed deck, i.e. the keyword set and the error handling.
+    /// Images are only written by eager parsing, so lazy parsing may use
+    /// them as well.
+    static std::size_t parserHash(const Parser& parser, const ParseContext& parseContext);
+
+    /// The cached deck, if the image exists and all input files are
+    /// unchanged.  The warnings of the original parse are issued again.
+    std::optional<Deck> loadDeck();
+
+    /// Record a warning which the parser has written directly to the log.
+    void recordWarning(const std::string& message);
+
+    /// Record that \p file with \p content was loaded by the parser.  The
+    /// first file recorded is the root file.
+    void recordFile(const std::filesystem::path& file, std::string_view content);
+    void recordFile(const std::filesystem::path& file);
+
+    /// Extend the context hash with a chunk of root file input.
+    std::size_t updateContext(std::string_view root_input);
+
+    /// Start a new segment for an INCLUDE statement in the root file.  If
+    /// an unchanged segment for the same file and context exists in the
+    /// cache its keywords are added to \p deck and true is returned.
+    bool beginInclude(const std::string& parent_file,
+                      const std::string& include_file,
+                      Deck& deck);
+
+    void endInclude(std::size_t deck_size);
+    bool insideInclude() const;
+    void recordInclude(const std::string& parent_file, const std::string& include_file);
+
+    /// The current segment has side effects beyond adding keywords, and
+    /// cannot be restored from the cache.
+    void invalidateInclude();
+
+    /// The deck can not be restored from the cache at all.
+    void invalidate();
+
+    const std::string& rootFile() const;
+
+    /// Write the image of \p deck to the cache directory.  Failure to do so
+    /// is logged, but otherwise ignored.
+    void store(const Deck& deck);
+
+private:
+    struct Image {
+        std::size_t parser_hash = 0;
+        std::string data_file;
+        std::vector<FileStamp> files;
+        std::vector<Segment> segments;
+        std::vector<Warning> warnings;
+        Deck deck;
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(parser_hash);
+            serializer(data_file);
+            serializer(files);
+            serializer(segments);
+            serializer(warnings);
+            serializer(deck);
+        }
+    };
+
+    void collectWarnings();
+    void replayWarnings(const std::vector<Warning>& replay);
+
+    std::filesystem::path cache_file;
+    std::string data_file;
+    std::size_t parser_hash;
+    const ParseContext& parse_context;
+    ErrorGuard& errors;
+
+    std::optional<Image> cached;
+    std::vector<FileStamp> files;
+    std::vector<Segment> segments;
+    std::optional<Segment> open_segment;
+    bool open_segment_valid = true;
+    bool valid = true;
+    std::size_t context = 0;
+    std::vector<Warning> warnings;
+    std::size_t warning_mark = 0;
+};
+
+}
+
+#endif
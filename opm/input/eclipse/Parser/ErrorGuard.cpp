@@ -25,6 +25,19 @@
 
 namespace Opm {
 
+    ErrorGuard::ErrorGuard(const ErrorGuard& other)
+        : error_list(other.error_list)
+        , warning_list(other.warning_list)
+    {}
+
+
+    ErrorGuard& ErrorGuard::operator=(const ErrorGuard& other) {
+        this->error_list = other.error_list;
+        this->warning_list = other.warning_list;
+        return *this;
+    }
+
+
     void ErrorGuard::addError(const std::string& errorKey, const std::string& msg) {
         this->error_list.emplace_back(errorKey, msg);
     }
@@ -66,6 +79,13 @@ namespace Opm {
         this->error_list.clear();
     }
 
+    std::weak_ptr<ErrorGuard*> ErrorGuard::handle() {
+        if (!this->self)
+            this->self = std::make_shared<ErrorGuard*>(this);
+
+        return this->self;
+    }
+
     void ErrorGuard::terminate() const {
         this->dump();
         std::exit(1);
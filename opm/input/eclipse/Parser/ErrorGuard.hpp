@@ -21,19 +21,37 @@
 #ifndef ERROR_GUARD_HPP
 #define ERROR_GUARD_HPP
 
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm {
 
 class ErrorGuard {
 public:
+    ErrorGuard() = default;
+
+    // Copies take the messages, but not the handle() of the original.
+    ErrorGuard(const ErrorGuard& other);
+    ErrorGuard& operator=(const ErrorGuard& other);
+
     void addError(const std::string& errorKey, const std::string& msg);
     void addWarning(const std::string& errorKey, const std::string &msg);
     void clear();
 
+    const std::vector<std::pair<std::string, std::string>>& warnings() const { return this->warning_list; }
+
     explicit operator bool() const { return !this->error_list.empty(); }
 
+    /*
+      Handle to this guard which expires when the guard is destroyed. Work
+      which is deferred beyond the call that received the guard, like
+      materialising lazily parsed keywords, uses it to report to the guard
+      for as long as it exists.
+    */
+    std::weak_ptr<ErrorGuard*> handle();
+
     /*
       Observe that this desctructor has a somewhat special semantics. If there
       are errors in the error list it will print all warnings and errors on
@@ -47,6 +65,7 @@ private:
 
     std::vector<std::pair<std::string, std::string>> error_list;
     std::vector<std::pair<std::string, std::string>> warning_list;
+    std::shared_ptr<ErrorGuard*> self{};
 };
 
 }
@@ -23,6 +23,7 @@
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ParserItem.hpp>
@@ -63,6 +64,7 @@
 #include <filesystem>
 #include <iostream>
 #include <iterator>
+#include <memory>
 #include <optional>
 #include <stack>
 #include <stdexcept>
@@ -445,14 +447,35 @@ class InputStack : public std::stack< file, std::vector< file > > {
     public:
         void push( std::string&& input, std::filesystem::path p = "<memory string>" );
 
+        /// The part of the root file input which has been consumed since
+        /// the previous call.
+        std::string_view consumeRoot();
+
+        /// The cleaned input buffers; lazily parsed keywords keep a
+        /// reference to these to keep their raw records valid.
+        std::shared_ptr< const std::list< std::string > > storage() const;
+
     private:
-        std::list< std::string > string_storage;
+        std::shared_ptr< std::list< std::string > > string_storage = std::make_shared< std::list< std::string > >();
+        std::size_t root_offset = 0;
         using base = std::stack< file, std::vector< file > >;
 };
 
 void InputStack::push( std::string&& input, std::filesystem::path p ) {
-    this->string_storage.push_back( std::move( input ) );
-    this->emplace( p, this->string_storage.back() );
+    this->string_storage->push_back( std::move( input ) );
+    this->emplace( p, this->string_storage->back() );
+}
+
+std::shared_ptr< const std::list< std::string > > InputStack::storage() const {
+    return this->string_storage;
+}
+
+std::string_view InputStack::consumeRoot() {
+    const std::string_view root = this->string_storage->front();
+    const auto offset = static_cast<std::size_t>(this->c.front().input.data() - root.data());
+    const auto chunk = root.substr(this->root_offset, offset - this->root_offset);
+    this->root_offset = offset;
+    return chunk;
 }
 
 class ParserState {
@@ -463,18 +486,21 @@ class ParserState {
 
         ParserState( const std::vector<std::pair<std::string,std::string>>&,
                      const ParseContext&, ErrorGuard&,
-                     std::filesystem::path, const std::set<Opm::Ecl::SectionType>& ignore = {});
+                     std::filesystem::path, const std::set<Opm::Ecl::SectionType>& ignore = {},
+                     std::unique_ptr<DeckCache> cache = {});
 
         void loadString( const std::string& );
         void loadFile( const std::filesystem::path& );
         void openRootFile( const std::filesystem::path& );
 
         void handleRandomText(const std::string_view& ) const;
+        void warning( const std::string& msg ) const;
         std::optional<std::filesystem::path> getIncludeFilePath( std::string ) const;
         void addPathAlias( const std::string& alias, const std::string& path );
 
         const std::filesystem::path& current_path() const;
         size_t line() const;
+        std::string_view consumeRoot();
 
         bool done() const;
         std::string_view getline();
@@ -484,6 +510,8 @@ class ParserState {
         const std::set<Opm::Ecl::SectionType>& get_ignore() {return ignore_sections; };
         bool check_section_keywords(bool& has_edit, bool& has_regions, bool& has_summary);
 
+        DeckKeyword lazyKeyword( const ParserKeyword&, std::unique_ptr<RawKeyword> );
+
     private:
         const std::vector<std::pair<std::string, std::string>> code_keywords;
         InputStack input_stack;
@@ -491,6 +519,13 @@ class ParserState {
         std::set<Opm::Ecl::SectionType> ignore_sections;
         std::map< std::string, std::string > pathMap;
 
+        // Everything a lazily parsed keyword needs must outlive both the
+        // ParserState and the Parser, and is shared between the keywords.
+        std::map< const ParserKeyword*, std::shared_ptr<const ParserKeyword> > lazy_parser_keywords;
+        std::shared_ptr< std::pair<UnitSystem, UnitSystem> > lazy_units;
+        std::shared_ptr< const ParseContext > lazy_context;
+        std::weak_ptr< ErrorGuard* > lazy_errors;
+
     public:
         ParserKeywordSizeEnum lastSizeType = SLASH_TERMINATED;
         std::string lastKeyWord;
@@ -498,9 +533,11 @@ class ParserState {
         Deck deck;
         std::filesystem::path rootPath;
         std::unique_ptr<Python> python;
+        std::unique_ptr<DeckCache> deck_cache;
         const ParseContext& parseContext;
         ErrorGuard& errors;
         bool unknown_keyword = false;
+        bool lazy = false;
 };
 
 const std::filesystem::path& ParserState::current_path() const {
@@ -511,6 +548,10 @@ size_t ParserState::line() const {
     return this->input_stack.top().lineNR;
 }
 
+std::string_view ParserState::consumeRoot() {
+    return this->input_stack.consumeRoot();
+}
+
 bool ParserState::done() const {
 
     while( !this->input_stack.empty() &&
@@ -562,17 +603,72 @@ ParserState::ParserState( const std::vector<std::pair<std::string, std::string>>
                           const ParseContext& context,
                           ErrorGuard& errors_arg,
                           std::filesystem::path p,
-                          const std::set<Opm::Ecl::SectionType>& ignore ) :
+                          const std::set<Opm::Ecl::SectionType>& ignore,
+                          std::unique_ptr<DeckCache> cache ) :
     code_keywords(code_keywords_arg),
     ignore_sections(ignore),
     rootPath( std::filesystem::canonical( p ).parent_path() ),
     python( std::make_unique<Python>() ),
+    deck_cache( std::move(cache) ),
     parseContext( context ),
     errors( errors_arg )
 {
     openRootFile( p );
 }
 
+DeckKeyword ParserState::lazyKeyword( const ParserKeyword& parserKeyword, std::unique_ptr<RawKeyword> rawKeyword ) {
+    auto& parser_keyword = this->lazy_parser_keywords[&parserKeyword];
+    if (!parser_keyword)
+        parser_keyword = std::make_shared<const ParserKeyword>(parserKeyword);
+
+    const auto& active_units = this->deck.getActiveUnitSystem();
+    if (!this->lazy_units || (this->lazy_units->first.getType() != active_units.getType()))
+        this->lazy_units = std::make_shared<std::pair<UnitSystem, UnitSystem>>(active_units, this->deck.getDefaultUnitSystem());
+
+    if (!this->lazy_context) {
+        this->lazy_context = std::make_shared<const ParseContext>(this->parseContext);
+        this->lazy_errors = this->errors.handle();
+    }
+
+    const auto location = rawKeyword->location();
+    const auto name = rawKeyword->getKeywordName();
+    std::shared_ptr<const RawKeyword> raw_keyword = std::move(rawKeyword);
+
+    return DeckKeyword(location, name,
+                       [parser_keyword,
+                        raw_keyword,
+                        units = this->lazy_units,
+                        context = this->lazy_context,
+                        errors = this->lazy_errors,
+                        storage = this->input_stack.storage()]()
+    {
+        // ParserKeyword::parse() consumes the raw records; parse a copy so
+        // a failed attempt can be repeated.
+        auto raw_copy = *raw_keyword;
+        ErrorGuard keyword_errors;
+        try {
+            // While the guard the deck was parsed with still exists, the
+            // diagnostics go there, exactly as with eager parsing.
+            if (const auto parse_errors = errors.lock())
+                return parser_keyword->parse(*context, **parse_errors, raw_copy, units->first, units->second);
+
+            auto deck_keyword = parser_keyword->parse(*context, keyword_errors, raw_copy, units->first, units->second);
+            if (keyword_errors) {
+                keyword_errors.dump();
+                keyword_errors.clear();
+                throw OpmInputError("Problem parsing keyword {keyword} in {file} line {line}", raw_keyword->location());
+            }
+            return deck_keyword;
+        } catch (const OpmInputError&) {
+            throw;
+        } catch (const std::exception& e) {
+            const OpmInputError opm_error { e, raw_keyword->location() };
+            OpmLog::error(opm_error.what());
+            std::throw_with_nested(opm_error);
+        }
+    });
+}
+
 bool ParserState::check_section_keywords(bool& has_edit, bool& has_regions, bool& has_summary) {
 
     std::string_view root_file_str = this->input_stack.top().input;
@@ -650,6 +746,9 @@ void ParserState::loadFile(const std::filesystem::path& inputFile) {
         throw std::runtime_error( "Error when reading input file '"
                                   + inputFile.string() + "'" );
 
+    if (this->deck_cache)
+        this->deck_cache->recordFile( inputFile, std::string_view{ buffer.data(), readc } );
+
     this->input_stack.push( str::clean( this->code_keywords, buffer ), inputFile );
 }
 
@@ -691,6 +790,12 @@ void ParserState::openRootFile( const std::filesystem::path& inputFile) {
     this->rootPath = inputFileCanonical.parent_path();
 }
 
+void ParserState::warning( const std::string& msg ) const {
+    OpmLog::warning(msg);
+    if (this->deck_cache)
+        this->deck_cache->recordWarning(msg);
+}
+
 std::optional<std::filesystem::path> ParserState::getIncludeFilePath( std::string path ) const {
     static const std::string pathKeywordPrefix("$");
     static const std::string validPathNameCharacters("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
@@ -709,7 +814,7 @@ std::optional<std::filesystem::path> ParserState::getIncludeFilePath( std::strin
     if (path.find('\\') != std::string::npos) {
         // ... if so, replace with slashes and create a warning.
         std::replace(path.begin(), path.end(), '\\', '/');
-        OpmLog::warning("Replaced one or more backslash with a slash in an INCLUDE path.");
+        this->warning("Replaced one or more backslash with a slash in an INCLUDE path.");
     }
 
     // trim leading and trailing whitespace just like the other simulator
@@ -1295,6 +1400,11 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         if( !rawKeyword )
             continue;
 
+        if (parserState.deck_cache &&
+            parserState.deck_cache->insideInclude() &&
+            (rawKeyword->location().filename == parserState.deck_cache->rootFile()))
+            parserState.deck_cache->endInclude(parserState.deck.size());
+
         std::string_view keyw = rawKeyword->getKeywordName();
         if ((ignore_grid) && (keyw == "GRID")){
             
@@ -1378,6 +1488,9 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                 parserState.addPathAlias( pathName, pathValue );
             }
 
+            if (parserState.deck_cache)
+                parserState.deck_cache->invalidateInclude();
+
             continue;
         }
 
@@ -1387,23 +1500,40 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             const auto& includeFile = parserState.getIncludeFilePath( includeFileAsString );
 
             if (includeFile.has_value()) {
+                const auto parent_file = std::filesystem::absolute(parserState.current_path()).string();
+
+                if (parserState.deck_cache) {
+                    auto& deck_cache = *parserState.deck_cache;
+                    if (rawKeyword->location().filename == deck_cache.rootFile()) {
+                        deck_cache.updateContext( parserState.consumeRoot() );
+                        if (deck_cache.beginInclude(parent_file, includeFile.value().string(), parserState.deck))
+                            continue;
+                    } else
+                        deck_cache.recordInclude(parent_file, includeFile.value().string());
+                }
+
                 auto& deck_tree = parserState.deck.tree();
-                deck_tree.add_include(std::filesystem::absolute(parserState.current_path()), includeFile.value() );
+                deck_tree.add_include(parent_file, includeFile.value() );
                 parserState.loadFile( includeFile.value() );
-            }
+            } else if (parserState.deck_cache)
+                parserState.deck_cache->invalidate();
             continue;
         }
 
         if( parser.isRecognizedKeyword( rawKeyword->getKeywordName() ) ) {
             const auto& kwname = rawKeyword->getKeywordName();
             const auto& parserKeyword = parser.getParserKeywordFromDeckName( kwname );
+            // Copied - a lazily parsed keyword takes ownership of the raw keyword.
+            const auto location = rawKeyword->location();
             {
-                const auto& location = rawKeyword->location();
                 auto msg = fmt::format("{:5} Reading {:<8} in {} line {}", parserState.deck.size(), rawKeyword->getKeywordName(), location.filename, location.lineno);
                 OpmLog::info(msg);
             }
             try {
                 if (rawKeyword->getKeywordName() ==  Opm::RawConsts::pyinput) {
+                    if (parserState.deck_cache)
+                        parserState.deck_cache->invalidate();
+
                     if (parserState.python) {
                         std::string python_string = rawKeyword->getFirstRecord().getRecordString();
                         parserState.python->exec(python_string, parser, parserState.deck);
@@ -1411,6 +1541,10 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                     else
                         throw std::logic_error("Cannot yet embed Python while still running Python.");
                 }
+                else if (parserState.lazy && (kwname != ParserKeywords::IMPORT::keywordName)) {
+                    if (!do_not_add)
+                        parserState.deck.addKeyword( parserState.lazyKeyword( parserKeyword, std::move(rawKeyword) ) );
+                }
                 else {
                     auto deck_keyword = parserKeyword.parse( parserState.parseContext,
                                                              parserState.errors,
@@ -1421,6 +1555,8 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                     if (deck_keyword.name() == ParserKeywords::IMPORT::keywordName) {
                         bool formatted = deck_keyword.getRecord(0).getItem(1).get<std::string>(0)[0] == 'F';
                         const auto& import_file = parserState.getIncludeFilePath(deck_keyword.getRecord(0).getItem(0).getTrimmedString(0));
+                        if (parserState.deck_cache)
+                            parserState.deck_cache->recordFile(import_file.value());
 
                         ImportContainer import(parser, parserState.deck.getActiveUnitSystem(), import_file.value().string(), formatted, parserState.deck.size());
                         for (auto kw : import)
@@ -1442,7 +1578,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                   same exception without updating the what() message of the
                   exception.
                 */
-                const OpmInputError opm_error { e, rawKeyword->location() } ;
+                const OpmInputError opm_error { e, location } ;
 
                 OpmLog::error(opm_error.what());
 
@@ -1451,7 +1587,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         } else {
             const std::string msg = "The keyword " + rawKeyword->getKeywordName() + " is not recognized - ignored";
             KeywordLocation location(rawKeyword->getKeywordName(), parserState.current_path().string(), parserState.line());
-            OpmLog::warning(Log::fileMessage(location, msg));
+            parserState.warning(Log::fileMessage(location, msg));
         }
     }
 
@@ -1568,9 +1704,28 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         else
             data_file = std::filesystem::proximate( std::filesystem::canonical(dataFileName) );
 
-        ParserState parserState( this->codeKeywords(), parseContext, errors, data_file, ignore_sections);
+        std::unique_ptr<DeckCache> deck_cache;
+        if (this->deck_cache_dir.has_value() && ignore_sections.empty()) {
+            deck_cache = std::make_unique<DeckCache>(this->deck_cache_dir.value(), data_file,
+                                                     DeckCache::parserHash(*this, parseContext),
+                                                     parseContext, errors);
+            auto cached_deck = deck_cache->loadDeck();
+            if (cached_deck.has_value()) {
+                OpmLog::info(fmt::format("Loaded deck {} from cache", data_file));
+                return std::move(cached_deck.value());
+            }
+        }
+
+        ParserState parserState( this->codeKeywords(), parseContext, errors, data_file, ignore_sections, std::move(deck_cache));
+        parserState.lazy = this->lazy_parsing;
         parseState( parserState, *this );
-        
+
+        // Serializing the deck materializes every keyword, which would
+        // defeat lazy parsing and report its parse errors as a failed
+        // cache write.  Lazy parsing therefore only reads the cache.
+        if (parserState.deck_cache && !errors && !this->lazy_parsing)
+            parserState.deck_cache->store(parserState.deck);
+
         auto ignore = parserState.get_ignore();
         
         if (ignore.size() > 0)
@@ -1602,6 +1757,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
 
     Deck Parser::parseString(const std::string &data, const ParseContext& parseContext, ErrorGuard& errors) const {
         ParserState parserState( this->codeKeywords(), parseContext, errors );
+        parserState.lazy = this->lazy_parsing;
         parserState.loadString( data );
         parseState( parserState, *this );
         return std::move( parserState.deck );
@@ -1617,8 +1773,33 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         return this->parseString(data, ParseContext(), errors);
     }
 
+    void Parser::enableDeckCache(const std::filesystem::path& cache_dir) {
+        this->deck_cache_dir = cache_dir;
+    }
+
+    void Parser::setLazyParsing(bool lazy) {
+        this->lazy_parsing = lazy;
+    }
+
+    bool Parser::lazyParsing() const {
+        return this->lazy_parsing;
+    }
+
     size_t Parser::size() const {
-        return m_deckParserKeywords.size();
+        return m_deckParserKeywords.size() + m_builtinKeywords.size();
+    }
+
+    const ParserKeyword* Parser::findKeyword(std::string_view deck_name) const
+    {
+        const auto explicit_keyword = this->m_deckParserKeywords.find(deck_name);
+        if (explicit_keyword != this->m_deckParserKeywords.end())
+            return explicit_keyword->second;
+
+        const auto builtin_keyword = this->m_builtinKeywords.find(deck_name);
+        if (builtin_keyword != this->m_builtinKeywords.end())
+            return &builtin_keyword->second();
+
+        return nullptr;
     }
 
     const ParserKeyword* Parser::matchingKeyword(const std::string_view& name) const
@@ -1627,9 +1808,15 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                                      m_wildCardKeywords.end(),
                                      [&name](const auto& wild)
                                      {
-                                         return wild.second->matches(name);
+                                         const auto& prefixes = wild.second.prefixes;
+                                         const auto candidate =
+                                             std::any_of(prefixes.begin(), prefixes.end(),
+                                                         [&name](const std::string& prefix)
+                                                         { return name.substr(0, prefix.size()) == prefix; });
+
+                                         return candidate && wild.second.keyword->matches(name);
                                      });
-        return it != m_wildCardKeywords.end() ? it->second : nullptr;
+        return it != m_wildCardKeywords.end() ? it->second.keyword : nullptr;
     }
 
     bool Parser::hasWildCardKeyword(const std::string& internalKeywordName) const {
@@ -1643,13 +1830,15 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         }
 
         return (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end())
+            || (this->m_builtinKeywords.find(name) != this->m_builtinKeywords.end())
             || (this->matchingKeyword(name) != nullptr);
     }
 
     bool Parser::isBaseRecognizedKeyword(std::string_view name) const
     {
         return ParserKeyword::validDeckName(name)
-            && (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end());
+            && ((this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end()) ||
+                (this->m_builtinKeywords.find(name) != this->m_builtinKeywords.end()));
     }
 
 void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
@@ -1675,11 +1864,12 @@ void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
     for (const auto& deck_name : ptr->deck_names())
     {
         m_deckParserKeywords[deck_name] = ptr;
+        m_builtinKeywords.erase(deck_name);
     }
 
     if (ptr->hasMatchRegex()) {
         std::string_view name( ptr->getName() );
-        m_wildCardKeywords[ name ] = ptr;
+        m_wildCardKeywords[ name ] = WildCardKeyword{ ptr, ptr->matchPrefixes() };
     }
 
     if (ptr->isCodeKeyword())
@@ -1687,13 +1877,17 @@ void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
 }
 
 
+void Parser::addBuiltinKeyword(const BuiltinKeyword& builtin) {
+    m_builtinKeywords[builtin.deck_name] = builtin.keyword;
+    m_deckParserKeywords.erase(builtin.deck_name);
+}
+
 void Parser::addParserKeyword(const Json::JsonObject& jsonKeyword) {
     addParserKeyword( ParserKeyword( jsonKeyword ) );
 }
 
 bool Parser::hasKeyword( const std::string& name ) const {
-    return this->m_deckParserKeywords.find( std::string_view( name ) )
-        != this->m_deckParserKeywords.end();
+    return this->findKeyword( name ) != nullptr;
 }
 
 const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
@@ -1701,9 +1895,9 @@ const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
 }
 
 const ParserKeyword& Parser::getParserKeywordFromDeckName(const std::string_view& name ) const {
-    auto candidate = m_deckParserKeywords.find( name );
+    const auto* candidate = this->findKeyword( name );
 
-    if( candidate != m_deckParserKeywords.end() ) return *candidate->second;
+    if( candidate ) return *candidate;
 
     const auto* wildCardKeyword = matchingKeyword( name );
 
@@ -1718,6 +1912,11 @@ std::vector<std::string> Parser::getAllDeckNames () const {
     for (auto iterator = m_deckParserKeywords.begin(); iterator != m_deckParserKeywords.end(); iterator++) {
         keywords.push_back(std::string(iterator->first));
     }
+    for (const auto& [deck_name, keyword] : m_builtinKeywords) {
+        keywords.emplace_back(deck_name);
+    }
+    // The deck names are hashed, sort them to retain a stable order.
+    std::sort(keywords.begin(), keywords.end());
     for (auto iterator = m_wildCardKeywords.begin(); iterator != m_wildCardKeywords.end(); iterator++) {
         keywords.push_back(std::string(iterator->first));
     }
@@ -25,7 +25,10 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -53,6 +56,18 @@ namespace Opm {
     class ErrorGuard;
     class RawKeyword;
 
+    namespace ParserKeywords {
+        /// The process wide instance of the builtin keyword \p Keyword.  It
+        /// is constructed, in a thread safe manner, the first time it is
+        /// requested.
+        template <class Keyword>
+        const ParserKeyword& builtinInstance()
+        {
+            static const Keyword keyword;
+            return keyword;
+        }
+    }
+
     /// The hub of the parsing process.
     /// An input file in the eclipse data format is specified, several steps of parsing is performed
     /// and the semantically parsed result is returned.
@@ -87,10 +102,46 @@ namespace Opm {
 
         Deck parseStream(std::unique_ptr<std::istream>&& inputStream , const ParseContext& parseContext, ErrorGuard& errors) const;
 
+        /// Keep a persistent binary image of every deck parsed with
+        /// parseFile() in \p cache_dir.  When the input files are unchanged
+        /// the deck is loaded from the image instead of being parsed; when
+        /// some include files have changed only those are parsed again.
+        /// Section filtered parsing never uses the cache, and lazy parsing
+        /// never writes it.
+        void enableDeckCache(const std::filesystem::path& cache_dir);
+
+        /// In lazy mode the parser only splits the input into keywords and
+        /// records; the items of a keyword are first parsed when the
+        /// keyword is accessed through the Deck.  Parse errors are then
+        /// handled at that point according to the ParseContext, and the
+        /// diagnostics are recorded in the ErrorGuard passed to the parse
+        /// call as long as that guard exists.  Problems found after the
+        /// guard has been destroyed are raised as OpmInputError exceptions.
+        /// The keywords IMPORT and PYINPUT are always parsed immediately.
+        ///
+        /// The first access to a keyword parses it in place through a
+        /// const reference, which is not thread-safe; keywords must be
+        /// materialized before a deck is shared between threads.
+        void setLazyParsing(bool lazy);
+        bool lazyParsing() const;
+
         /// Method to add ParserKeyword instances, these holding type and size information about the keywords and their data.
         void addParserKeyword(const Json::JsonObject& jsonKeyword);
         void addParserKeyword(ParserKeyword parserKeyword);
 
+        /// Deck name of a builtin keyword, along with the function
+        /// returning the shared ParserKeyword instance.
+        struct BuiltinKeyword {
+            std::string_view deck_name;
+            const ParserKeyword& (*keyword)();
+        };
+
+        /// Register a builtin keyword without constructing it; this is
+        /// used by the generated addDefaultKeywords() code.  Keywords
+        /// which match a regular expression, or contain code, must be
+        /// added with addParserKeyword().
+        void addBuiltinKeyword(const BuiltinKeyword& builtin);
+
         /*!
          * \brief Returns whether the parser knows about a keyword
          */
@@ -171,19 +222,35 @@ namespace Opm {
     private:
         bool hasWildCardKeyword(const std::string& keyword) const;
         const ParserKeyword* matchingKeyword(const std::string_view& keyword) const;
+        const ParserKeyword* findKeyword(std::string_view deck_name) const;
         void addDefaultKeywords();
 
         // std::vector< std::unique_ptr< const ParserKeyword > > keyword_storage;
         std::list<ParserKeyword> keyword_storage;
 
         // associative map of deck names and the corresponding ParserKeyword object
-        std::map< std::string_view, const ParserKeyword* > m_deckParserKeywords;
+        std::unordered_map< std::string_view, const ParserKeyword* > m_deckParserKeywords;
+
+        // builtin keywords which have not been added explicitly; a deck
+        // name is only present in one of the two maps
+        std::unordered_map< std::string_view, const ParserKeyword& (*)() > m_builtinKeywords;
+
+        // keywords which match a regular expression, along with the literal
+        // prefixes used to avoid evaluating the regular expression for names
+        // which can not match
+        struct WildCardKeyword {
+            const ParserKeyword* keyword;
+            std::vector<std::string> prefixes;
+        };
 
         // associative map of the parser internal names and the corresponding
-        // ParserKeyword object for keywords which match a regular expression
-        std::map< std::string_view, const ParserKeyword* > m_wildCardKeywords;
+        // wildcard keyword
+        std::map< std::string_view, WildCardKeyword > m_wildCardKeywords;
 
         std::vector<std::pair<std::string,std::string>> code_keywords;
+
+        std::optional<std::filesystem::path> deck_cache_dir;
+        bool lazy_parsing = false;
     };
 
 } // namespace Opm
@@ -23,6 +23,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <opm/json/JsonObject.hpp>
 
@@ -553,6 +554,56 @@ std::string KeywordSize::construct() const
 
 namespace {
 
+/*
+  Split a regular expression into its top level alternatives, and extract
+  the leading literal characters of each, e.g. {"BU", "BTIPF"} for
+  "BU.+|BTIPF.+".  Alternatives which do not start with a literal, like
+  "(A|B)C", yield an empty prefix.
+*/
+std::vector<std::string> literal_prefixes( const std::string& regex ) {
+    std::vector<std::string> prefixes;
+    std::string prefix;
+    bool literal = true;
+    int depth = 0;
+
+    for (std::size_t index = 0; index < regex.size(); index++) {
+        const char c = regex[index];
+        if (c == '|' && depth == 0) {
+            prefixes.push_back( prefix );
+            prefix.clear();
+            literal = true;
+            continue;
+        }
+
+        if (c == '(' || c == '[')
+            depth += 1;
+        else if (c == ')' || c == ']')
+            depth -= 1;
+
+        if (!literal)
+            continue;
+
+        if (!(std::isalnum( static_cast<unsigned char>(c) ) || c == '_')) {
+            literal = false;
+            continue;
+        }
+
+        const char next = (index + 1 < regex.size()) ? regex[index + 1] : '\0';
+        if (next == '?' || next == '*' || next == '{') {
+            // The character is optional.
+            literal = false;
+            continue;
+        }
+
+        prefix += c;
+        if (next == '+')
+            literal = false;
+    }
+
+    prefixes.push_back( prefix );
+    return prefixes;
+}
+
 void set_dimensions( ParserItem& item,
                     const Json::JsonObject& json,
                     const std::string& keyword ) {
@@ -909,6 +960,26 @@ void set_dimensions( ParserItem& item,
         return false;
     }
 
+    std::vector<std::string> ParserKeyword::matchPrefixes() const {
+        std::vector<std::string> prefixes;
+        for (const auto& deckName : this->m_deckNames) {
+            const auto deck_prefixes = literal_prefixes(deckName);
+            prefixes.insert(prefixes.end(), deck_prefixes.begin(), deck_prefixes.end());
+        }
+
+        if (this->hasMatchRegex()) {
+            const auto regex_prefixes = literal_prefixes(this->m_matchRegexString);
+            prefixes.insert(prefixes.end(), regex_prefixes.begin(), regex_prefixes.end());
+        }
+
+        std::sort(prefixes.begin(), prefixes.end());
+        prefixes.erase(std::unique(prefixes.begin(), prefixes.end()), prefixes.end());
+        if (!prefixes.empty() && prefixes.front().empty())
+            return { "" };
+
+        return prefixes;
+    }
+
     bool ParserKeyword::matchesDeckNames(std::string_view name) const
     {
         const auto nameStr = std::string { name };
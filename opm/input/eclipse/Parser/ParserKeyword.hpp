@@ -98,6 +98,12 @@ namespace Opm {
         void setMatchRegex(const std::string& deckNameRegexp);
         void setMatchRegexSuffix(const std::string& deckNameRegexp);
         bool matches(const std::string_view& ) const;
+
+        // The literal strings one of which a name must start with for
+        // matches() to succeed, derived from the deck names and the match
+        // regex.  An empty string in the list means no such restriction
+        // could be established.
+        std::vector<std::string> matchPrefixes() const;
         bool hasDimension() const;
         void addRecord( ParserRecord );
         void addDataRecord( ParserRecord );
@@ -69,10 +69,13 @@ py::cpp_function py_actionx_callback(const std::function<void(const std::string&
 
 }
 
-bool PyRunModule::executeInnerRunFunction(const std::function<void(const std::string&, const std::vector<std::string>&)>& actionx_callback) {
-    auto cpp_callback = py_actionx_callback(actionx_callback);
+py::object PyRunModule::make_callback(const std::function<void(const std::string&, const std::vector<std::string>&)>& actionx_callback) {
+    return py_actionx_callback(actionx_callback);
+}
+
+bool PyRunModule::executeInnerRunFunction(const py::object& actionx_callback) {
     try {
-        py::object result = this->run_function(this->opm_embedded.attr("current_ecl_state"), this->opm_embedded.attr("current_schedule"), this->opm_embedded.attr("current_report_step"), this->opm_embedded.attr("current_summary_state"), cpp_callback);
+        py::object result = this->run_function(this->opm_embedded.attr("current_ecl_state"), this->opm_embedded.attr("current_schedule"), this->opm_embedded.attr("current_report_step"), this->opm_embedded.attr("current_summary_state"), actionx_callback);
         return result.cast<bool>();
     } catch (const std::exception& e) {
         OpmLog::error(fmt::format("Exception thrown when calling run(ecl_state, schedule, report_step, summary_state, actionx_callback) function of {}: {}", this->module_name, e.what()));
@@ -83,6 +86,10 @@ bool PyRunModule::executeInnerRunFunction(const std::function<void(const std::st
 }
 
 bool PyRunModule::run(EclipseState& ecl_state, Schedule& sched, std::size_t report_step, SummaryState& st, const std::function<void(const std::string&, const std::vector<std::string>&)>& actionx_callback) {
+    return this->run(ecl_state, sched, report_step, st, make_callback(actionx_callback));
+}
+
+bool PyRunModule::run(EclipseState& ecl_state, Schedule& sched, std::size_t report_step, SummaryState& st, const py::object& actionx_callback) {
     // The attributes need to be set before the user defined module is loaded; it needs to be set in every call.
     this->opm_embedded.attr("current_report_step") = report_step;
 
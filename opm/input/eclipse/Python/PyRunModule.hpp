@@ -43,6 +43,11 @@ public:
     PyRunModule(std::shared_ptr<const Python> python, const std::string& fname);
 
     bool run(EclipseState& ecl_state, Schedule& sched, std::size_t report_step, SummaryState& st, const std::function<void(const std::string&, const std::vector<std::string>&)>& actionx_callback);
+    bool run(EclipseState& ecl_state, Schedule& sched, std::size_t report_step, SummaryState& st, const py::object& actionx_callback);
+
+    // Python callable wrapping actionx_callback, can be shared between
+    // several calls to run().
+    static py::object make_callback(const std::function<void(const std::string&, const std::vector<std::string>&)>& actionx_callback);
 
 private:
     py::object run_function = py::none();
@@ -52,7 +57,7 @@ private:
     std::string module_name;
     py::module opm_embedded;
     py::dict storage;
-    bool executeInnerRunFunction(const std::function<void(const std::string&, const std::vector<std::string>&)>& actionx_callback);
+    bool executeInnerRunFunction(const py::object& actionx_callback);
 };
 
 }
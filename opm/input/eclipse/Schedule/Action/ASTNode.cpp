@@ -29,9 +29,13 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -61,8 +65,296 @@ namespace {
 
         return strings;
     }
+
+    // Set of wells, represented as bits in a dense well numbering.
+    class WellMask
+    {
+    public:
+        void insert(const std::size_t well)
+        {
+            const auto word = well / bits;
+            if (word >= this->words_.size()) {
+                this->words_.resize(word + 1, 0);
+            }
+
+            this->words_[word] |= std::uint64_t{1} << (well % bits);
+        }
+
+        WellMask& operator|=(const WellMask& other)
+        {
+            if (other.words_.size() > this->words_.size()) {
+                this->words_.resize(other.words_.size(), 0);
+            }
+
+            for (auto i = 0*other.words_.size(); i < other.words_.size(); ++i) {
+                this->words_[i] |= other.words_[i];
+            }
+
+            return *this;
+        }
+
+        WellMask& operator&=(const WellMask& other)
+        {
+            if (other.words_.size() < this->words_.size()) {
+                this->words_.resize(other.words_.size());
+            }
+
+            for (auto i = 0*this->words_.size(); i < this->words_.size(); ++i) {
+                this->words_[i] &= other.words_[i];
+            }
+
+            return *this;
+        }
+
+        template <typename Function>
+        void for_each(Function&& f) const
+        {
+            for (auto i = 0*this->words_.size(); i < this->words_.size(); ++i) {
+                // Shift the word rather than the mask, a shift by the full
+                // word width is undefined.
+                auto bit = 0*bits;
+                for (auto word = this->words_[i]; word != 0; word >>= 1, ++bit) {
+                    if ((word & 1) != 0) {
+                        f(i*bits + bit);
+                    }
+                }
+            }
+        }
+
+    private:
+        static constexpr std::size_t bits = 64;
+        std::vector<std::uint64_t> words_{};
+    };
+
+    // Dense numbering of the wells encountered while evaluating a single
+    // condition.  Wells known to the summary state are numbered by their
+    // position in the sorted list of all wells, while any other well--e.g.,
+    // from a well list or an explicit context value--is numbered on first
+    // use.
+    class WellIndex
+    {
+    public:
+        explicit WellIndex(const std::vector<std::string>& wells)
+            : wells_ { wells }
+        {}
+
+        std::size_t operator()(const std::string& well)
+        {
+            auto pos = std::lower_bound(this->wells_.begin(), this->wells_.end(), well);
+            if ((pos != this->wells_.end()) && (*pos == well)) {
+                return std::distance(this->wells_.begin(), pos);
+            }
+
+            auto other = std::find(this->other_.begin(), this->other_.end(), well);
+            if (other == this->other_.end()) {
+                other = this->other_.insert(other, well);
+            }
+
+            return this->wells_.size() + std::distance(this->other_.begin(), other);
+        }
+
+        const std::string& name(const std::size_t well) const
+        {
+            return (well < this->wells_.size())
+                ? this->wells_[well]
+                : this->other_[well - this->wells_.size()];
+        }
+
+    private:
+        const std::vector<std::string>& wells_;
+        std::vector<std::string> other_{};
+    };
+
+    // Intermediate condition result.  Like Action::Result, but with the
+    // matching wells represented as a WellMask.
+    struct Outcome
+    {
+        bool value{false};
+        std::optional<WellMask> wells{};
+    };
 } // Anonymous namespace
 
+// Evaluates a condition tree directly on dense well masks, and converts the
+// matching wells to names only if the condition as a whole is true.
+// Operands of AND/OR are skipped once the truth value is settled, provided
+// they cannot contribute matching wells.
+class Opm::Action::ASTNode::Evaluator
+{
+public:
+    explicit Evaluator(const Context& context)
+        : context_ { context }
+        , index_   { context.wells() }
+    {}
+
+    Result operator()(const ASTNode& node)
+    {
+        const auto outcome = this->eval(node);
+
+        if (! outcome.value) {
+            return Result { false };
+        }
+
+        if (! outcome.wells.has_value()) {
+            return Result { true };
+        }
+
+        auto wells = WellSet{};
+        outcome.wells->for_each([this, &wells](const std::size_t well)
+        {
+            wells.add(this->index_.name(well));
+        });
+
+        return Result { true, wells };
+    }
+
+private:
+    const Context& context_;
+    WellIndex index_;
+
+    static bool is_well_operand(const ASTNode& node)
+    {
+        return (node.type == TokenType::ecl_expr)
+            && (node.func_type == FuncType::well)
+            && ! node.arg_list.empty();
+    }
+
+    static bool has_well_operands(const ASTNode& node)
+    {
+        return is_well_operand(node)
+            || std::any_of(node.children.begin(), node.children.end(),
+                           [](const ASTNode& child)
+                           { return has_well_operands(child); });
+    }
+
+    Outcome eval(const ASTNode& node)
+    {
+        if (node.empty()) {
+            throw std::invalid_argument {
+                "ASTNode::eval() should not reach leafnodes"
+            };
+        }
+
+        if ((node.type == TokenType::op_or) ||
+            (node.type == TokenType::op_and))
+        {
+            return this->eval_logical(node);
+        }
+
+        return this->eval_comparison(node);
+    }
+
+    Outcome eval_logical(const ASTNode& node)
+    {
+        const auto is_and = node.type == TokenType::op_and;
+
+        auto result = Outcome { is_and };
+        for (const auto& child : node.children) {
+            if ((result.value != is_and) && ! has_well_operands(child)) {
+                // Truth value settled and operand would not change the
+                // set of matching wells.
+                continue;
+            }
+
+            auto outcome = this->eval(child);
+
+            result.value = is_and
+                ? (result.value && outcome.value)
+                : (result.value || outcome.value);
+
+            if (! outcome.wells.has_value()) {
+                continue;
+            }
+
+            if (! result.wells.has_value()) {
+                result.wells = std::move(outcome.wells);
+            }
+            else if (is_and) {
+                *result.wells &= *outcome.wells;
+            }
+            else {
+                *result.wells |= *outcome.wells;
+            }
+        }
+
+        return result;
+    }
+
+    Outcome eval_comparison(const ASTNode& node)
+    {
+        const auto& lhs = node.children.front();
+        const auto& rhs = node.children[1];
+
+        auto v2 = Value {};
+
+        // Special casing of MONTH comparisons where in addition symbolic
+        // month names we can compare with numeric months, in the case of
+        // numeric months the numerical value should be rounded before
+        // comparison - i.e.
+        //
+        //   MNTH = 4.3
+        //
+        // should evaluate to true for the month of April (4).
+        if ((lhs.func_type == FuncType::time_month) &&
+            (rhs.type == TokenType::number))
+        {
+            v2 = Value { std::round(rhs.number) };
+        }
+        else {
+            v2 = rhs.value(this->context_);
+        }
+
+        if (! is_well_operand(lhs) || ! lhs.children.empty()) {
+            return Outcome { static_cast<bool>(lhs.value(this->context_).eval_cmp(node.type, v2)) };
+        }
+
+        const auto threshold = v2.scalar();
+
+        auto outcome = Outcome { false, WellMask{} };
+        this->well_values(lhs, [&node, threshold, &outcome]
+                          (const std::size_t well, const double value)
+        {
+            if (eval_cmp_scalar(value, node.type, threshold)) {
+                outcome.wells->insert(well);
+                outcome.value = true;
+            }
+        });
+
+        return outcome;
+    }
+
+    template <typename Function>
+    void well_values(const ASTNode& node, Function&& f)
+    {
+        const auto& well_arg = node.arg_list.front();
+
+        if ((node.arg_list.size() != 1) ||
+            (well_arg.find("*") == std::string::npos))
+        {
+            const auto arg_key = fmt::format("{}", fmt::join(node.arg_list, ":"));
+            f(this->index_(well_arg), this->context_.get(node.func, arg_key));
+            return;
+        }
+
+        if ((well_arg.front() == '*') && (well_arg.size() > 1)) {
+            for (const auto& well : this->context_.wlist_manager().wells(well_arg)) {
+                f(this->index_(well), this->context_.get(node.func, well));
+            }
+
+            return;
+        }
+
+        // Only wells for which the summary state actually holds a value
+        // of the vector.  In particular, well level UDQs which have not
+        // yet been evaluated match no wells.
+        const auto pattern = ShellPattern { well_arg };
+        for (const auto& well : this->context_.wells(node.func)) {
+            if (pattern.match(well)) {
+                f(this->index_(well), this->context_.get(node.func, well));
+            }
+        }
+    }
+};
+
 Opm::Action::ASTNode::ASTNode()
     : ASTNode { TokenType::error }
 {}
@@ -157,10 +449,11 @@ Opm::Action::ASTNode::value(const Action::Context& context) const
         }
         else {
             const auto& wells = context.wells(this->func);
+            const auto pattern = ShellPattern { well_arg };
             std::copy_if(wells.begin(), wells.end(), std::back_inserter(wnames),
-                        [&well_arg](const auto& well)
+                        [&pattern](const auto& well)
                         {
-                            return shmatch(well_arg, well);
+                            return pattern.match(well);
                         });
         }
 
@@ -185,50 +478,7 @@ Opm::Action::ASTNode::value(const Action::Context& context) const
 Opm::Action::Result
 Opm::Action::ASTNode::eval(const Action::Context& context) const
 {
-    if (this->empty()) {
-        throw std::invalid_argument {
-            "ASTNode::eval() should not reach leafnodes"
-        };
-    }
-
-    if ((this->type == TokenType::op_or) ||
-        (this->type == TokenType::op_and))
-    {
-        auto result = Result { this->type == TokenType::op_and };
-
-        for (const auto& child : this->children) {
-            if (this->type == TokenType::op_or) {
-                result |= child.eval(context);
-            }
-            else {
-                result &= child.eval(context);
-            }
-        }
-
-        return result;
-    }
-
-    auto v2 = Value {};
-
-    // Special casing of MONTH comparisons where in addition symbolic month
-    // names we can compare with numeric months, in the case of numeric
-    // months the numerical value should be rounded before comparison - i.e.
-    //
-    //   MNTH = 4.3
-    //
-    // should evaluate to true for the month of April (4).
-    if (this->children.front().func_type == FuncType::time_month) {
-        const auto& rhs = this->children[1];
-
-        v2 = (rhs.type == TokenType::number)
-            ? Value { std::round(rhs.number) }
-            : rhs.value(context);
-    }
-    else {
-        v2 = this->children[1].value(context);
-    }
-
-    return this->children.front().value(context).eval_cmp(this->type, v2);
+    return Evaluator { context }(*this);
 }
 
 bool Opm::Action::ASTNode::operator==(const ASTNode& data) const
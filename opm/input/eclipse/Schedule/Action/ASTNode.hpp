@@ -74,6 +74,8 @@ public:
     }
 
 private:
+    class Evaluator;
+
     std::vector<std::string> arg_list{};
     double number {0.0};
 
@@ -61,6 +61,11 @@ namespace Action {
     }
 
 
+    const std::vector<std::string>& Context::wells() const {
+        return this->summary_state.wells();
+    }
+
+
     const WListManager& Context::wlist_manager() const {
         return this->wlm;
     }
@@ -53,6 +53,12 @@ public:
     void   add(const std::string& func, double value);
 
     std::vector<std::string> wells(const std::string& func) const;
+
+    /*
+      All wells known to the summary state in alphabetical order.
+    */
+    const std::vector<std::string>& wells() const;
+
     const WListManager& wlist_manager() const;
 
 private:
@@ -67,25 +67,27 @@ inline std::string tokenString(TokenType op) {
 }
 #endif
 
-bool eval_cmp_scalar(const double lhs, const Opm::Action::TokenType op, const double rhs)
+} // Anonymous namespace
+
+bool Opm::Action::eval_cmp_scalar(const double lhs, const TokenType op, const double rhs)
 {
     switch (op) {
-    case Opm::Action::TokenType::op_eq:
+    case TokenType::op_eq:
         return lhs == rhs;
 
-    case Opm::Action::TokenType::op_ge:
+    case TokenType::op_ge:
         return lhs >= rhs;
 
-    case Opm::Action::TokenType::op_le:
+    case TokenType::op_le:
         return lhs <= rhs;
 
-    case Opm::Action::TokenType::op_ne:
+    case TokenType::op_ne:
         return lhs != rhs;
 
-    case Opm::Action::TokenType::op_gt:
+    case TokenType::op_gt:
         return lhs > rhs;
 
-    case Opm::Action::TokenType::op_lt:
+    case TokenType::op_lt:
         return lhs < rhs;
 
     default:
@@ -95,8 +97,6 @@ bool eval_cmp_scalar(const double lhs, const Opm::Action::TokenType op, const do
     }
 }
 
-} // Anonymous namespace
-
 Opm::Action::Value::Value(double value)
     : scalar_value(value)
     , is_scalar(true)
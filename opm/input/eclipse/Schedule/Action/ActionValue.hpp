@@ -62,6 +62,9 @@ enum class FuncType
     block,
 };
 
+/// Apply comparison operator \p op to a pair of scalar operands.
+bool eval_cmp_scalar(double lhs, TokenType op, double rhs);
+
 class Value
 {
 public:
@@ -114,6 +114,15 @@ bool PyAction::run(EclipseState&, Schedule&, std::size_t, SummaryState&,
     return false;
 }
 
+void PyAction::run_batch(const std::vector<const PyAction*>& actions,
+                         EclipseState&, Schedule&, std::size_t, SummaryState&,
+                         const std::function<void(const std::string&, const std::vector<std::string>&)>&,
+                         const std::function<void(const PyAction&, bool)>& on_result)
+{
+    for (const auto* action : actions)
+        on_result(*action, false);
+}
+
 PyAction::PyAction(std::shared_ptr<const Python>, const std::string& name, RunCount run_count, const std::string& fname) :
     m_name(name),
     m_run_count(run_count),
@@ -149,6 +158,27 @@ bool PyAction::run(EclipseState& ecl_state, Schedule& schedule, std::size_t repo
 }
 
 
+void PyAction::run_batch(const std::vector<const PyAction*>& actions,
+                         EclipseState& ecl_state, Schedule& schedule, std::size_t report_step, SummaryState& st,
+                         const std::function<void(const std::string&, const std::vector<std::string>&)>& actionx_callback,
+                         const std::function<void(const PyAction&, bool)>& on_result)
+{
+    if (actions.empty())
+        return;
+
+    py::gil_scoped_acquire gil;
+    const auto callback = PyRunModule::make_callback(actionx_callback);
+
+    for (const auto* action : actions) {
+        // See PyAction::run() for modules which must be imported here.
+        if (!action->run_module)
+            action->run_module = std::make_shared<Opm::PyRunModule>(schedule.python(), action->module_file);
+
+        on_result(*action, action->run_module->run(ecl_state, schedule, report_step, st, callback));
+    }
+}
+
+
 
 #endif
 
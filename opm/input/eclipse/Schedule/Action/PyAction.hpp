@@ -52,6 +52,17 @@ public:
     PyAction(std::shared_ptr<const Python> python, const std::string& name, RunCount run_count, const std::string& module_file);
     bool run(EclipseState& ecl_state, Schedule& schedule, std::size_t report_step, SummaryState& st,
              const std::function<void(const std::string&, const std::vector<std::string>&)>& actionx_callback) const;
+
+    /*
+      Run several PYACTION scripts in order, acquiring the Python interpreter
+      and wrapping the actionx_callback only once for the whole batch. The
+      result of each script is passed to on_result() as soon as that script
+      has completed.
+    */
+    static void run_batch(const std::vector<const PyAction*>& actions,
+                          EclipseState& ecl_state, Schedule& schedule, std::size_t report_step, SummaryState& st,
+                          const std::function<void(const std::string&, const std::vector<std::string>&)>& actionx_callback,
+                          const std::function<void(const PyAction&, bool)>& on_result);
     const std::string& name() const;
     bool ready(const State& state) const;
     bool operator==(const PyAction& other) const;
@@ -0,0 +1,67 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/ChangeStamps.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+namespace Opm {
+
+ChangeStamps::ChangeStamps()
+    : base_ { next() }
+{}
+
+// A copy may be modified independently of the original, so none of the
+// original's stamps carry over.
+ChangeStamps::ChangeStamps(const ChangeStamps&)
+    : ChangeStamps {}
+{}
+
+ChangeStamps& ChangeStamps::operator=(const ChangeStamps&)
+{
+    this->touch_all();
+    return *this;
+}
+
+void ChangeStamps::touch(const std::string& key)
+{
+    this->keys_.insert_or_assign(key, next());
+}
+
+void ChangeStamps::touch_all()
+{
+    this->keys_.clear();
+    this->base_ = next();
+}
+
+std::size_t ChangeStamps::get(const std::string& key) const
+{
+    const auto pos = this->keys_.find(key);
+    return (pos != this->keys_.end()) ? pos->second : this->base_;
+}
+
+std::size_t ChangeStamps::next()
+{
+    static std::atomic<std::size_t> stamp{0};
+    return ++stamp;
+}
+
+} // namespace Opm
@@ -0,0 +1,62 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef CHANGE_STAMPS_HPP
+#define CHANGE_STAMPS_HPP
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+namespace Opm {
+
+/// Records when the values stored under a set of keys last changed.
+///
+/// Stamps are drawn from a single, process wide and increasing counter,
+/// so stamps obtained from different objects may be compared and an
+/// unchanged stamp implies unchanged values.  Keys which have not been
+/// touched report the stamp of the object's creation.  Copies, and objects
+/// whose values are replaced wholesale through touch_all(), report a new
+/// stamp for all keys.
+class ChangeStamps
+{
+public:
+    ChangeStamps();
+    ChangeStamps(const ChangeStamps&);
+    ChangeStamps& operator=(const ChangeStamps&);
+
+    /// Record a change of the values stored under \p key.
+    void touch(const std::string& key);
+
+    /// Record a change of all values.
+    void touch_all();
+
+    /// Stamp of the last change of the values stored under \p key.
+    std::size_t get(const std::string& key) const;
+
+private:
+    std::size_t base_{};
+    std::unordered_map<std::string, std::size_t> keys_{};
+
+    static std::size_t next();
+};
+
+} // namespace Opm
+
+#endif // CHANGE_STAMPS_HPP
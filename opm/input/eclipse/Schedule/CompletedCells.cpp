@@ -96,6 +96,11 @@ Opm::CompletedCells::try_get(std::size_t i, std::size_t j, std::size_t k)
     return { !inserted, pos->second };
 }
 
+bool Opm::CompletedCells::contains(std::size_t global_index) const
+{
+    return this->cells.find(global_index) != this->cells.end();
+}
+
 bool Opm::CompletedCells::operator==(const Opm::CompletedCells& other) const
 {
     return (this->dims == other.dims)
@@ -107,6 +107,7 @@ public:
 
     const Cell& get(std::size_t i, std::size_t j, std::size_t k) const;
     std::pair<bool, Cell&> try_get(std::size_t i, std::size_t j, std::size_t k);
+    bool contains(std::size_t global_index) const;
 
     bool operator==(const CompletedCells& other) const;
     static CompletedCells serializationTestObject();
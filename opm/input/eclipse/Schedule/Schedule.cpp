@@ -57,6 +57,7 @@
 #include <opm/input/eclipse/Schedule/RFTConfig.hpp>
 #include <opm/input/eclipse/Schedule/RPTConfig.hpp>
 #include <opm/input/eclipse/Schedule/ScheduleGrid.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleStepIndex.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/Tuning.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQActive.hpp>
@@ -97,6 +98,7 @@
 #include "Well/injection.hpp"
 
 #include <algorithm>
+#include <array>
 #include <ctime>
 #include <functional>
 #include <initializer_list>
@@ -559,6 +561,53 @@ void check_compsegs_consistency(const Opm::WelSegsSet& welsegs,
         throw Opm::OpmInputError(msg, std::get<1>(difference[0]));
     }
 }
+
+/// Cells referenced with explicit I and J coordinates by the COMPDAT
+/// keywords in report steps [load_start, load_end), including those inside
+/// ACTIONX blocks.  Connections with defaulted coordinates depend on the
+/// well head, which is only known during the ordered keyword pass.
+std::vector<std::array<std::size_t, 3>>
+compdat_cells(const Opm::ScheduleDeck& sched_deck,
+              const std::size_t load_start,
+              const std::size_t load_end)
+{
+    std::vector<std::array<std::size_t, 3>> ijk;
+    for (auto report_step = load_start; report_step < load_end; ++report_step) {
+        for (const auto& keyword : sched_deck[report_step]) {
+            if (! keyword.is<Opm::ParserKeywords::COMPDAT>()) {
+                continue;
+            }
+
+            for (const auto& record : keyword) {
+                const auto& itemI = record.getItem("I");
+                const auto& itemJ = record.getItem("J");
+                const auto& itemK1 = record.getItem("K1");
+                const auto& itemK2 = record.getItem("K2");
+                if (itemI.defaultApplied(0) || itemJ.defaultApplied(0) ||
+                    ! itemK1.hasValue(0) || ! itemK2.hasValue(0))
+                {
+                    continue;
+                }
+
+                const auto I = itemI.get<int>(0);
+                const auto J = itemJ.get<int>(0);
+                const auto K1 = itemK1.get<int>(0);
+                const auto K2 = itemK2.get<int>(0);
+                if ((I <= 0) || (J <= 0) || (K1 <= 0)) {
+                    continue;
+                }
+
+                for (auto k = K1; k <= K2; ++k) {
+                    ijk.push_back({ static_cast<std::size_t>(I - 1),
+                                    static_cast<std::size_t>(J - 1),
+                                    static_cast<std::size_t>(k - 1) });
+                }
+            }
+        }
+    }
+
+    return ijk;
+}
 }// end anonymous namespace
 
 namespace Opm
@@ -570,7 +619,8 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                                       const std::unordered_map<std::string, double> * target_wellpi,
                                       const std::string& prefix,
                                       const bool keepKeywords,
-                                      const bool log_to_debug)
+                                      const bool log_to_debug,
+                                      std::vector<ScheduleState>* previous_snapshots)
 {
         std::vector<std::pair< const DeckKeyword* , std::size_t> > rftProperties;
         std::string time_unit = this->m_static.m_unit_system.name(UnitSystem::measure::time);
@@ -620,6 +670,13 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                                location.lineno));
         }
 
+        // The cell geometry and properties needed for the connections are
+        // independent of the schedule state; compute them concurrently
+        // ahead of the ordered keyword pass.
+        grid.prefetch(compdat_cells(this->m_sched_deck,
+                                    std::max(load_start, this->m_static.rst_info.report_step),
+                                    load_end));
+
         std::set<std::string> compsegs_wells;
         WelSegsSet welsegs_wells;
 
@@ -727,7 +784,54 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
             if (!keepKeywords) {
                 this->m_sched_deck.clearKeywords(report_step);
             }
+
+            if (previous_snapshots != nullptr) {
+                const auto previous = report_step - load_start;
+                if ((previous < previous_snapshots->size()) &&
+                    (this->snapshots.back() == (*previous_snapshots)[previous]))
+                {
+                    logger(fmt::format("Report step {} is unchanged, reusing "
+                                       "the remaining {} report steps",
+                                       report_step, previous_snapshots->size() - previous - 1));
+
+                    this->snapshots.insert(this->snapshots.end(),
+                                           std::make_move_iterator(previous_snapshots->begin() + previous + 1),
+                                           std::make_move_iterator(previous_snapshots->end()));
+                    break;
+                }
+            }
         } // for (auto report_step = load_start
+
+        grid.clear_prefetched();
+    }
+
+    /*
+      Remove and return the snapshots following report_step, to be passed as
+      previous_snapshots to iterateScheduleSection() when the Schedule section
+      is iterated again after keywords have been applied at report_step.
+    */
+    std::vector<ScheduleState> Schedule::detachSnapshots(std::size_t report_step) {
+        std::vector<ScheduleState> detached;
+        if (report_step + 1 < this->snapshots.size()) {
+            detached.assign(std::make_move_iterator(this->snapshots.begin() + report_step + 1),
+                            std::make_move_iterator(this->snapshots.end()));
+        }
+        this->snapshots.resize(report_step + 1);
+        return detached;
+    }
+
+    std::map<std::string, std::size_t> Schedule::shallowMemoryUsage() const {
+        std::map<std::string, ScheduleState::StorageUsage> usage;
+        for (const auto& snapshot : this->snapshots) {
+            snapshot.storageUsage(usage);
+        }
+
+        std::map<std::string, std::size_t> bytes;
+        for (const auto& [member, member_usage] : usage) {
+            bytes.emplace(member, member_usage.bytes);
+        }
+        bytes.emplace("ScheduleState", this->snapshots.size() * sizeof(ScheduleState));
+        return bytes;
     }
 
     void Schedule::applyGlobalWPIMULT( const std::unordered_map<std::string, double>& wpimult_global_factor) {
@@ -1117,24 +1221,20 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     }
 
     std::vector< Well > Schedule::getChildWells2(const std::string& group_name, std::size_t timeStep) const {
-        const auto& sched_state = this->snapshots[timeStep];
-        const auto& group = sched_state.groups.get(group_name);
+        const auto index = this->stepIndex(timeStep);
+        const auto group_index = index->groupIndex(group_name);
+        if (!group_index.has_value())
+            throw std::out_of_range(fmt::format("No such group: {} at report step {}", group_name, timeStep));
+
+        const auto& child_wells = index->childWells(*group_index);
 
         std::vector<Well> wells;
+        wells.reserve(child_wells.size());
+        std::transform(child_wells.begin(), child_wells.end(),
+                       std::back_inserter(wells),
+                       [](const Well* well) -> decltype(auto)
+                       { return *well; });
 
-        if (group.groups().size()) {
-            for (const auto& child_name : group.groups()) {
-                const auto& child_wells = this->getChildWells2(child_name, timeStep);
-                wells.insert(wells.end(), child_wells.begin(), child_wells.end());
-            }
-        } else {
-            std::transform(group.wells().begin(), group.wells().end(),
-                           std::back_inserter(wells),
-                           [this, timeStep](const auto& well_name) -> decltype(auto)
-                           {
-                               return this->getWell(well_name, timeStep);
-                           });
-        }
         return wells;
     }
 
@@ -1172,8 +1272,20 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
 
     std::vector<Well> Schedule::getWells(std::size_t timeStep) const
     {
+        const auto index = this->stepIndex(timeStep);
+
         auto wells = std::vector<Well>{};
+        wells.reserve(index->numWells());
+        std::transform(index->wells().begin(), index->wells().end(),
+                       std::back_inserter(wells),
+                       [](const Well* well) -> decltype(auto)
+                       { return *well; });
 
+        return wells;
+    }
+
+    std::shared_ptr<const ScheduleStepIndex> Schedule::stepIndex(std::size_t timeStep) const
+    {
         if (timeStep >= this->snapshots.size()) {
             throw std::invalid_argument {
                 fmt::format("timeStep {} exceeds simulation run's "
@@ -1182,14 +1294,34 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
             };
         }
 
-        const auto& well_order = this->snapshots[timeStep].well_order();
-        std::transform(well_order.begin(), well_order.end(),
-                       std::back_inserter(wells),
-                       [&wells = this->snapshots[timeStep].wells]
-                       (const auto& wname) -> decltype(auto)
-                       { return wells.get(wname); });
+        const auto& sched_state = this->snapshots[timeStep];
+        auto& cache = *this->step_index_cache;
 
-        return wells;
+        std::lock_guard<std::mutex> lock { cache.mutex };
+        if (cache.indices.size() < this->snapshots.size())
+            cache.indices.resize(this->snapshots.size());
+
+        auto& index = cache.indices[timeStep];
+        if (index && index->current(sched_state))
+            return index;
+
+        // Report steps without changes to the wells and groups share the
+        // index of their neighbours, so the cache holds one index per
+        // distinct configuration rather than one per report step.
+        const auto neighbour = [&cache, &sched_state](const std::size_t step)
+        {
+            const auto& other = cache.indices[step];
+            return other && other->current(sched_state);
+        };
+
+        if ((timeStep > 0) && neighbour(timeStep - 1))
+            index = cache.indices[timeStep - 1];
+        else if ((timeStep + 1 < cache.indices.size()) && neighbour(timeStep + 1))
+            index = cache.indices[timeStep + 1];
+        else
+            index = std::make_shared<const ScheduleStepIndex>(sched_state);
+
+        return index;
     }
 
     std::vector<Well> Schedule::getWellsatEnd() const {
@@ -1250,12 +1382,7 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
     }
 
     const Well& Schedule::getWell(std::size_t well_index, std::size_t timeStep) const {
-        const auto find_pred = [well_index] (const auto& well_pair) -> bool
-        {
-            return well_pair.second->seqIndex() == well_index;
-        };
-
-        auto well_ptr = this->snapshots[timeStep].wells.find( find_pred );
+        const auto* well_ptr = this->stepIndex(timeStep)->findWellBySeqIndex(well_index);
         if (well_ptr == nullptr)
             throw std::invalid_argument(fmt::format("There is no well with well_index:{} at report_step:{}", well_index, timeStep));
 
@@ -1367,11 +1494,12 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         auto star_pos = pattern.find('*');
         if (star_pos != std::string::npos) {
             std::vector<std::string> names;
+            const auto compiled = ShellPattern { pattern };
             std::copy_if(group_order.begin(), group_order.end(),
                          std::back_inserter(names),
-                         [&pattern](const auto& gname)
+                         [&compiled](const auto& gname)
                          {
-                             return shmatch(pattern, gname);
+                             return compiled.match(gname);
                          });
             return names;
         }
@@ -1616,7 +1744,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         std::unordered_map<std::string, double> target_wellpi;
         std::vector<std::string> matching_wells;
         const std::string prefix = "| "; /* logger prefix string */
-        this->snapshots.resize(reportStep + 1);
+        auto previous_snapshots = this->detachSnapshots(reportStep);
         auto& input_block = this->m_sched_deck[reportStep];
         std::unordered_map<std::string, double> wpimult_global_factor;
         ScheduleLogger logger(ScheduleLogger::select_stream(false, false), // will log to OpmLog::info
@@ -1655,7 +1783,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                 errors,
                 grid,
                 &target_wellpi,
-                prefix, true);
+                prefix, true, false,
+                &previous_snapshots);
         }
         this->simUpdateFromPython->append(sim_update);
     }
@@ -1697,7 +1826,9 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                                   "keywords and\n{0}rerun Schedule section.\n{0}",
                                   prefix, action.name()));
 
-        this->snapshots.resize(reportStep + 1);
+        // Keep the current snapshots after reportStep; the iteration below
+        // reuses them once it has caught up with the effect of the action.
+        auto previous_snapshots = this->detachSnapshots(reportStep);
         auto& input_block = this->m_sched_deck[reportStep];
 
         std::unordered_map<std::string, double> wpimult_global_factor;
@@ -1741,7 +1872,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
             const auto log_to_debug = true;
             this->iterateScheduleSection(reportStep + 1, this->m_sched_deck.size(),
                                          parseContext, errors, grid, &target_wellpi,
-                                         prefix, keepKeywords, log_to_debug);
+                                         prefix, keepKeywords, log_to_debug,
+                                         &previous_snapshots);
         }
 
         OpmLog::debug("\\----------------------------------------------------------------------");
@@ -1839,9 +1971,14 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
 
     SimulatorUpdate Schedule::runPyAction(std::size_t reportStep, const Action::PyAction& pyaction, Action::State& action_state, EclipseState& ecl_state, SummaryState& summary_state) {
-        // Reset simUpdateFromPython, pyaction.run(...) will run through the PyAction script, the calls that trigger a simulator update will append this to simUpdateFromPython.
+        return this->runPyActions(reportStep, { &pyaction }, action_state, ecl_state, summary_state);
+    }
+
+
+    SimulatorUpdate Schedule::runPyActions(std::size_t reportStep, const std::vector<const Action::PyAction*>& pyactions, Action::State& action_state, EclipseState& ecl_state, SummaryState& summary_state) {
+        // Reset simUpdateFromPython, pyaction.run(...) will run through the PyAction scripts, the calls that trigger a simulator update will append this to simUpdateFromPython.
         this->simUpdateFromPython->reset();
-        // Set the current_report_step to the report step in which this PyAction was triggered.
+        // Set the current_report_step to the report step in which these PyActions were triggered.
         this->current_report_step = reportStep;
 
         // Set up the actionx_callback - simulator updates from this also get appended to simUpdateFromPython.
@@ -1850,10 +1987,15 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
             this->simUpdateFromPython->append(simUpdateFromActionXCallback);
         };
 
-        auto result = pyaction.run(ecl_state, *this, reportStep, summary_state, apply_action_callback);
-        action_state.add_run(pyaction, result);
+        // Each result is recorded as soon as the corresponding script has
+        // run, i.e. in the same order as with one runPyAction() call per
+        // PYACTION keyword.
+        Action::PyAction::run_batch(pyactions, ecl_state, *this, reportStep, summary_state, apply_action_callback,
+                                    [&action_state](const Action::PyAction& pyaction, bool result) {
+                                        action_state.add_run(pyaction, result);
+                                    });
 
-        // The whole pyaction script was executed, now the simUpdateFromPython is returned.
+        // The whole batch of pyaction scripts was executed, now the simUpdateFromPython is returned.
         return *(this->simUpdateFromPython);
     }
 
@@ -25,6 +25,7 @@
 #include <iosfwd>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -71,6 +72,7 @@ namespace Opm
     class Runspec;
     class RPTConfig;
     class ScheduleGrid;
+    class ScheduleStepIndex;
     class SCHEDULESection;
     class SegmentMatcher;
     class SummaryState;
@@ -248,6 +250,14 @@ namespace Opm
 
         std::vector<const Group*> getChildGroups2(const std::string& group_name, std::size_t timeStep) const;
         std::vector<Well> getChildWells2(const std::string& group_name, std::size_t timeStep) const;
+
+        /*
+          Dense, allocation free view of the wells and groups at report step
+          timeStep. The index is built on first use and reused until the
+          wells or groups of that report step change. Consecutive report
+          steps with the same wells and groups share one index.
+        */
+        std::shared_ptr<const ScheduleStepIndex> stepIndex(std::size_t timeStep) const;
         WellProducerCMode getGlobalWhistctlMmode(std::size_t timestep) const;
 
         const UDQConfig& getUDQConfig(std::size_t timeStep) const;
@@ -293,12 +303,31 @@ namespace Opm
         */
         SimulatorUpdate runPyAction(std::size_t reportStep, const Action::PyAction& pyaction, Action::State& action_state, EclipseState& ecl_state, SummaryState& summary_state);
 
+        /*
+          Run all the pending PYACTION keywords of a report step in order, with
+          the Python interpreter acquired once for the whole batch. The
+          returned SimulatorUpdate combines the updates from all the scripts.
+        */
+        SimulatorUpdate runPyActions(std::size_t reportStep, const std::vector<const Action::PyAction*>& pyactions, Action::State& action_state, EclipseState& ecl_state, SummaryState& summary_state);
+
 
         const GasLiftOpt& glo(std::size_t report_step) const;
 
         bool operator==(const Schedule& data) const;
         std::shared_ptr<const Python> python() const;
 
+        /*
+          Shallow memory footprint of the report step snapshots, in bytes,
+          by member. Each distinct object counts sizeof() of its type, and
+          objects shared between report steps are only counted once. Heap
+          storage owned by the objects, e.g. the elements of their vectors,
+          maps and strings, is NOT included, so the numbers are a lower
+          bound which is mainly useful to compare the degree of sharing
+          between report steps. The entry "ScheduleState" holds the size of
+          the snapshot objects themselves.
+        */
+        std::map<std::string, std::size_t> shallowMemoryUsage() const;
+
 
         const ScheduleState& back() const;
         const ScheduleState& operator[](std::size_t index) const;
@@ -406,6 +435,17 @@ namespace Opm
         // The copy constructor is needed for creating a mocked simulator (msim).
         std::shared_ptr<SimulatorUpdate> simUpdateFromPython{};
 
+        // The step_index_cache holds the indices created by stepIndex(), one
+        // slot per report step, with neighbouring slots sharing an index when
+        // the wells and groups are unchanged. It is shared between copies,
+        // which is safe since each index is validated against the report step
+        // before it is used.
+        struct StepIndexCache {
+            std::mutex mutex{};
+            std::vector<std::shared_ptr<const ScheduleStepIndex>> indices{};
+        };
+        std::shared_ptr<StepIndexCache> step_index_cache = std::make_shared<StepIndexCache>();
+
         void load_rst(const RestartIO::RstState& rst,
                       const TracerConfig& tracer_config,
                       const ScheduleGrid& grid,
@@ -431,6 +471,13 @@ namespace Opm
         bool checkGroups(const ParseContext& parseContext, ErrorGuard& errors);
         bool updateWellStatus( const std::string& well, std::size_t reportStep, WellStatus status, std::optional<KeywordLocation> = {});
         void addWellToGroup( const std::string& group_name, const std::string& well_name , std::size_t timeStep);
+        /*
+          If previous_snapshots is given it holds the snapshots from an
+          earlier iteration, starting at report step load_start. As soon as
+          a newly created snapshot compares equal to the earlier one all the
+          following steps would be recreated unchanged, and the remaining
+          earlier snapshots are moved into place instead.
+        */
         void iterateScheduleSection(std::size_t load_start,
                                     std::size_t load_end,
                                     const ParseContext& parseContext,
@@ -439,7 +486,9 @@ namespace Opm
                                     const std::unordered_map<std::string, double> * target_wellpi,
                                     const std::string& prefix,
                                     const bool keepKeywords,
-                                    const bool log_to_debug = false);
+                                    const bool log_to_debug = false,
+                                    std::vector<ScheduleState>* previous_snapshots = nullptr);
+        std::vector<ScheduleState> detachSnapshots(std::size_t report_step);
         void addACTIONX(const Action::ActionX& action);
         void addGroupToGroup( const std::string& parent_group, const std::string& child_group);
         void addGroup(const std::string& groupName , std::size_t timeStep);
@@ -24,8 +24,12 @@
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <exception>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -61,6 +65,57 @@ namespace {
             ? fp.try_get<double>(kw)->at(active_index)
             : 1.0;
     }
+
+    struct PropertyArrays
+    {
+        const std::vector<double>* porv{nullptr};
+        const std::vector<double>* permx{nullptr};
+        const std::vector<double>* permy{nullptr};
+        const std::vector<double>* permz{nullptr};
+        const std::vector<double>* poro{nullptr};
+        const std::vector<double>* ntg{nullptr};
+        const std::vector<int>* satnum{nullptr};
+        const std::vector<int>* pvtnum{nullptr};
+
+        // Resolve all the arrays get_cell() might ask for up front; the
+        // FieldPropsManager lookups are not safe to do concurrently.
+        // Returns false if any of them is unavailable, in which case
+        // get_cell() is left to report the problem for the relevant cell.
+        bool resolve(const Opm::FieldPropsManager& fp, const std::size_t num_active)
+        {
+            try {
+                for (auto [kw, arr] : { std::pair {"PORV", &this->porv},
+                                        std::pair {"PERMX", &this->permx},
+                                        std::pair {"PERMY", &this->permy},
+                                        std::pair {"PERMZ", &this->permz},
+                                        std::pair {"PORO", &this->poro} })
+                {
+                    if (! fp.has_double(kw)) {
+                        return false;
+                    }
+
+                    *arr = fp.try_get<double>(kw);
+                }
+
+                if (fp.has_double("NTG")) {
+                    this->ntg = fp.try_get<double>("NTG");
+                }
+
+                this->satnum = &fp.get_int("SATNUM");
+                this->pvtnum = &fp.get_int("PVTNUM");
+            }
+            catch (const std::exception&) {
+                return false;
+            }
+
+            const auto valid = [num_active](const auto* arr)
+            { return (arr != nullptr) && (arr->size() == num_active); };
+
+            return valid(this->porv) && valid(this->permx) && valid(this->permy)
+                && valid(this->permz) && valid(this->poro) && valid(this->satnum)
+                && valid(this->pvtnum) && ((this->ntg == nullptr) || valid(this->ntg));
+        }
+    };
 }
 
 const Opm::CompletedCells::Cell&
@@ -73,6 +128,14 @@ Opm::ScheduleGrid::get_cell(std::size_t i, std::size_t j, std::size_t k) const
     auto [valid, cellRef] = this->cells.try_get(i, j, k);
 
     if (!valid) {
+        if (auto pos = this->prefetched.find(cellRef.global_index);
+            pos != this->prefetched.end())
+        {
+            cellRef = std::move(pos->second);
+            this->prefetched.erase(pos);
+            return cellRef;
+        }
+
         cellRef.depth = this->grid->getCellDepth(i, j, k);
         cellRef.dimensions = this->grid->getCellDimensions(i, j, k);
 
@@ -96,6 +159,74 @@ Opm::ScheduleGrid::get_cell(std::size_t i, std::size_t j, std::size_t k) const
     return cellRef;
 }
 
+void Opm::ScheduleGrid::prefetch(const std::vector<std::array<std::size_t, 3>>& ijk) const
+{
+    this->prefetched.clear();
+    if ((this->grid == nullptr) || ijk.empty()) {
+        return;
+    }
+
+    PropertyArrays arrays;
+    if (! arrays.resolve(*this->fp, this->grid->getNumActive())) {
+        return;
+    }
+
+    std::vector<std::size_t> global_index;
+    global_index.reserve(ijk.size());
+    for (const auto& [i, j, k] : ijk) {
+        if ((i < this->grid->getNX()) && (j < this->grid->getNY()) && (k < this->grid->getNZ())) {
+            const auto g = this->grid->getGlobalIndex(i, j, k);
+            if (! this->cells.contains(g)) {
+                global_index.push_back(g);
+            }
+        }
+    }
+
+    std::sort(global_index.begin(), global_index.end());
+    global_index.erase(std::unique(global_index.begin(), global_index.end()),
+                       global_index.end());
+
+    std::vector<CompletedCells::Cell> cell_data(global_index.size());
+
+#pragma omp parallel for schedule(static)
+    for (std::size_t c = 0; c < global_index.size(); ++c) {
+        const auto g = global_index[c];
+        const auto [i, j, k] = this->grid->getIJK(g);
+        auto& cell = cell_data[c];
+
+        cell = CompletedCells::Cell { g, std::size_t(i), std::size_t(j), std::size_t(k) };
+        cell.depth = this->grid->getCellDepth(i, j, k);
+        cell.dimensions = this->grid->getCellDimensions(i, j, k);
+
+        if (this->grid->cellActive(i, j, k)) {
+            const auto active_index = this->grid->getActiveIndex(i, j, k);
+            const double porv = (*arrays.porv)[active_index];
+            if (this->grid->cellActiveAfterMINPV(i, j, k, porv)) {
+                auto& props = cell.props.emplace(CompletedCells::Cell::Props{});
+                props.active_index = active_index;
+                props.permx = (*arrays.permx)[active_index];
+                props.permy = (*arrays.permy)[active_index];
+                props.permz = (*arrays.permz)[active_index];
+                props.poro = (*arrays.poro)[active_index];
+                props.satnum = (*arrays.satnum)[active_index];
+                props.pvtnum = (*arrays.pvtnum)[active_index];
+                props.ntg = (arrays.ntg != nullptr) ? (*arrays.ntg)[active_index] : 1.0;
+            }
+        }
+    }
+
+    this->prefetched.reserve(cell_data.size());
+    for (auto& cell : cell_data) {
+        const auto g = cell.global_index;
+        this->prefetched.emplace(g, std::move(cell));
+    }
+}
+
+void Opm::ScheduleGrid::clear_prefetched() const
+{
+    this->prefetched.clear();
+}
+
 const Opm::EclipseGrid* Opm::ScheduleGrid::get_grid() const
 {
     return this->grid;
@@ -21,8 +21,11 @@
 
 #include <opm/input/eclipse/Schedule/CompletedCells.hpp>
 
+#include <array>
 #include <cstddef>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace Opm {
 
@@ -47,10 +50,23 @@ public:
 
     const Opm::EclipseGrid* get_grid() const;
 
+    /// Compute geometry and properties of the cells \p ijk in parallel.
+    ///
+    /// The prefetched cells are only moved into the CompletedCells
+    /// container when they are requested through get_cell(), i.e. the
+    /// set of completed cells is the same with or without prefetching.
+    /// Cells outside the grid are ignored and left for get_cell() to
+    /// diagnose, and cells which are already completed are skipped.
+    void prefetch(const std::vector<std::array<std::size_t, 3>>& ijk) const;
+
+    /// Discard prefetched cells which were never requested.
+    void clear_prefetched() const;
+
 private:
     const EclipseGrid* grid{nullptr};
     const FieldPropsManager* fp{nullptr};
     CompletedCells& cells;
+    mutable std::unordered_map<std::size_t, CompletedCells::Cell> prefetched{};
 };
 
 } // namespace Opm
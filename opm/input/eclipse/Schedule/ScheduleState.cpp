@@ -29,20 +29,25 @@
 #include <opm/input/eclipse/Schedule/Group/GuideRateConfig.hpp>
 #include <opm/input/eclipse/Schedule/Network/Balance.hpp>
 #include <opm/input/eclipse/Schedule/Network/ExtNetwork.hpp>
+#include <opm/input/eclipse/Schedule/ResCoup/ReservoirCouplingInfo.hpp>
 #include <opm/input/eclipse/Schedule/RFTConfig.hpp>
 #include <opm/input/eclipse/Schedule/RPTConfig.hpp>
+#include <opm/input/eclipse/Schedule/RSTConfig.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQActive.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
 #include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
 #include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
+#include <opm/input/eclipse/Schedule/Well/PAvg.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellMatcher.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellTestConfig.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <ctime>
+#include <map>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -87,6 +92,12 @@ bool ScheduleState::save() const {
     return this->m_save_step;
 }
 
+std::size_t ScheduleState::next_stamp()
+{
+    static std::atomic<std::size_t> stamp{0};
+    return ++stamp;
+}
+
 ScheduleState::ScheduleState(const time_point& t1)
     : m_start_time(clamp_time(t1))
     , m_first_in_month(true)
@@ -300,23 +311,29 @@ bool ScheduleState::operator==(const ScheduleState& other) const {
         && this->m_message_limits == other.m_message_limits
         && this->m_whistctl_mode == other.m_whistctl_mode
         && this->m_nupcol == other.m_nupcol
-        && this->network.get() == other.network.get()
-        && this->network_balance.get() == other.network_balance.get()
-        && this->wtest_config.get() == other.wtest_config.get()
-        && this->well_order.get() == other.well_order.get()
-        && this->group_order.get() == other.group_order.get()
-        && this->gconsale.get() == other.gconsale.get()
-        && this->gconsump.get() == other.gconsump.get()
-        && this->wlist_manager.get() == other.wlist_manager.get()
-        && this->rpt_config.get() == other.rpt_config.get()
-        && this->actions.get() == other.actions.get()
-        && this->udq_active.get() == other.udq_active.get()
-        && this->glo.get() == other.glo.get()
-        && this->guide_rate.get() == other.guide_rate.get()
-        && this->rft_config.get() == other.rft_config.get()
-        && this->udq.get() == other.udq.get()
-        && this->bhp_defaults.get() == other.bhp_defaults.get()
-        && this->source.get() == other.source.get()
+        && this->network == other.network
+        && this->network_balance == other.network_balance
+        && this->wtest_config == other.wtest_config
+        && this->well_order == other.well_order
+        && this->group_order == other.group_order
+        && this->gconsale == other.gconsale
+        && this->gconsump == other.gconsump
+        && this->gecon == other.gecon
+        && this->wlist_manager == other.wlist_manager
+        && this->rpt_config == other.rpt_config
+        && this->actions == other.actions
+        && this->udq_active == other.udq_active
+        && this->glo == other.glo
+        && this->guide_rate == other.guide_rate
+        && this->rft_config == other.rft_config
+        && this->rst_config == other.rst_config
+        && this->udq == other.udq
+        && this->bhp_defaults == other.bhp_defaults
+        && this->source == other.source
+        && this->pavg == other.pavg
+        && this->rescoup == other.rescoup
+        && this->aqufluxs == other.aqufluxs
+        && this->bcprop == other.bcprop
         && this->wells == other.wells
         && this->groups == other.groups
         && this->vfpprod == other.vfpprod
@@ -329,6 +346,35 @@ bool ScheduleState::operator==(const ScheduleState& other) const {
 
 
 
+void ScheduleState::storageUsage(std::map<std::string, StorageUsage>& usage) const {
+    this->gconsale.storageUsage(usage["gconsale"]);
+    this->gconsump.storageUsage(usage["gconsump"]);
+    this->gecon.storageUsage(usage["gecon"]);
+    this->guide_rate.storageUsage(usage["guide_rate"]);
+    this->wlist_manager.storageUsage(usage["wlist_manager"]);
+    this->well_order.storageUsage(usage["well_order"]);
+    this->group_order.storageUsage(usage["group_order"]);
+    this->actions.storageUsage(usage["actions"]);
+    this->udq.storageUsage(usage["udq"]);
+    this->udq_active.storageUsage(usage["udq_active"]);
+    this->pavg.storageUsage(usage["pavg"]);
+    this->wtest_config.storageUsage(usage["wtest_config"]);
+    this->glo.storageUsage(usage["glo"]);
+    this->network.storageUsage(usage["network"]);
+    this->network_balance.storageUsage(usage["network_balance"]);
+    this->rescoup.storageUsage(usage["rescoup"]);
+    this->rpt_config.storageUsage(usage["rpt_config"]);
+    this->rft_config.storageUsage(usage["rft_config"]);
+    this->rst_config.storageUsage(usage["rst_config"]);
+    this->bhp_defaults.storageUsage(usage["bhp_defaults"]);
+    this->source.storageUsage(usage["source"]);
+    this->vfpprod.storageUsage(usage["vfpprod"]);
+    this->vfpinj.storageUsage(usage["vfpinj"]);
+    this->groups.storageUsage(usage["groups"]);
+    this->wells.storageUsage(usage["wells"]);
+}
+
+
 ScheduleState ScheduleState::serializationTestObject() {
     auto t1 = TimeService::now();
     auto t2 = t1 + std::chrono::hours(48);
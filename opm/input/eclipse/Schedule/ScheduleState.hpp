@@ -38,11 +38,15 @@
 #include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
 #include <opm/input/eclipse/Schedule/RSTConfig.hpp>
 
+#include <array>
 #include <cstddef>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <optional>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 namespace {
@@ -114,6 +118,33 @@ namespace Opm {
 
 
 
+        /*
+          Bookkeeping for Schedule::shallowMemoryUsage(). Objects shared
+          between report steps are only counted once, and only the shallow
+          size of each object is included.
+        */
+        struct StorageUsage {
+            std::unordered_set<const void*> seen;
+            std::size_t bytes{0};
+
+            bool add(const void* object, std::size_t size) {
+                if (!this->seen.insert(object).second)
+                    return false;
+
+                this->bytes += size;
+                return true;
+            }
+        };
+
+        /*
+          The ptr_member and map_member instances carry a stamp, which is set
+          to a new, process wide unique value whenever the member is modified.
+          Copies share the stamp of the original until either is modified,
+          i.e. an unchanged stamp implies that the member still refers to the
+          same objects as when the stamp was recorded.
+        */
+        static std::size_t next_stamp();
+
         template <typename T>
         class ptr_member {
         public:
@@ -128,6 +159,7 @@ namespace Opm {
             void update(T object)
             {
                 this->m_data = std::make_shared<T>( std::move(object) );
+                this->m_stamp = next_stamp();
             }
 
             /*
@@ -137,20 +169,41 @@ namespace Opm {
             void update(const ptr_member<T>& other)
             {
                 this->m_data = other.m_data;
+                this->m_stamp = other.m_stamp;
+            }
+
+            std::size_t stamp() const {
+                return this->m_stamp;
             }
 
             const T& operator()() const {
                 return *this->m_data;
             }
 
+            /*
+              Compares the values; instances which share storage compare
+              equal without inspecting the value.
+            */
+            bool operator==(const ptr_member<T>& other) const {
+                return (this->m_data == other.m_data)
+                    || (*this->m_data == *other.m_data);
+            }
+
+            void storageUsage(StorageUsage& usage) const {
+                usage.add(this->m_data.get(), sizeof(T));
+            }
+
             template<class Serializer>
             void serializeOp(Serializer& serializer)
             {
                 serializer(m_data);
+                if (!serializer.isSerializing())
+                    this->m_stamp = next_stamp();
             }
 
         private:
             std::shared_ptr<T> m_data;
+            std::size_t m_stamp{0};
         };
 
 
@@ -163,22 +216,95 @@ namespace Opm {
               const K& T::name() const;
 
           Which is used to get the storage key for the objects.
+
+          The map itself is split in a fixed number of shards, selected by
+          the hash of the key, and each shard is a shared copy-on-write
+          hash map. Copying a map_member, as done for every new report step,
+          only copies the shard pointers, and updating an element copies
+          the one shard holding it. Unchanged shards, and the elements in
+          them, are hence shared between all the report steps.
          */
 
         template <typename K, typename T>
         class map_member {
+            using Shard = std::unordered_map<K, std::shared_ptr<T>>;
+            static constexpr std::size_t num_shards = 32;
+
         public:
+            class const_iterator {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = typename Shard::value_type;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const value_type*;
+                using reference = const value_type&;
+
+                reference operator*() const { return *this->m_iter; }
+                pointer operator->() const { return &*this->m_iter; }
+
+                const_iterator& operator++() {
+                    ++this->m_iter;
+                    this->skip_empty();
+                    return *this;
+                }
+
+                const_iterator operator++(int) {
+                    auto current = *this;
+                    ++(*this);
+                    return current;
+                }
+
+                bool operator==(const const_iterator& other) const {
+                    return (this->m_shard == other.m_shard)
+                        && ((this->m_shard == num_shards) || (this->m_iter == other.m_iter));
+                }
+
+                bool operator!=(const const_iterator& other) const {
+                    return !(*this == other);
+                }
+
+            private:
+                friend class map_member;
+
+                const_iterator(const map_member* map, std::size_t shard)
+                    : m_map(map)
+                    , m_shard(shard)
+                {
+                    if (this->m_shard < num_shards) {
+                        this->m_iter = this->m_map->m_shards[this->m_shard]->begin();
+                        this->skip_empty();
+                    }
+                }
+
+                void skip_empty() {
+                    while (this->m_iter == this->m_map->m_shards[this->m_shard]->end()) {
+                        if (++this->m_shard == num_shards)
+                            return;
+
+                        this->m_iter = this->m_map->m_shards[this->m_shard]->begin();
+                    }
+                }
+
+                const map_member* m_map{nullptr};
+                std::size_t m_shard{num_shards};
+                typename Shard::const_iterator m_iter{};
+            };
+
+            map_member() {
+                this->m_shards.fill(empty_shard());
+            }
+
             std::vector<K> keys() const {
                 std::vector<K> key_vector;
-                std::transform( this->m_data.begin(), this->m_data.end(), std::back_inserter(key_vector), [](const auto& pair) { return pair.first; });
+                std::transform( this->begin(), this->end(), std::back_inserter(key_vector), [](const auto& pair) { return pair.first; });
                 return key_vector;
             }
 
 
             template <typename Predicate>
             const T* find(Predicate&& predicate) const {
-                auto iter = std::find_if( this->m_data.begin(), this->m_data.end(), std::forward<Predicate>(predicate));
-                if (iter == this->m_data.end())
+                auto iter = std::find_if( this->begin(), this->end(), std::forward<Predicate>(predicate));
+                if (iter == this->end())
                     return nullptr;
 
                 return iter->second.get();
@@ -186,8 +312,9 @@ namespace Opm {
 
 
             const std::shared_ptr<T> get_ptr(const K& key) const {
-                auto iter = this->m_data.find(key);
-                if (iter != this->m_data.end())
+                const auto& shard = *this->m_shards[shard_index(key)];
+                auto iter = shard.find(key);
+                if (iter != shard.end())
                     return iter->second;
 
                 return {};
@@ -202,15 +329,22 @@ namespace Opm {
 
             void update(T object) {
                 auto key = object.name();
-                this->m_data[key] = std::make_shared<T>( std::move(object) );
+                this->mutable_shard(key)[key] = std::make_shared<T>( std::move(object) );
+                this->m_stamp = next_stamp();
             }
 
             void update(const K& key, const map_member<K,T>& other) {
                 auto other_ptr = other.get_ptr(key);
                 if (other_ptr)
-                    this->m_data[key] = other.get_ptr(key);
+                    this->mutable_shard(key)[key] = std::move(other_ptr);
                 else
                     throw std::logic_error(std::string{"Tried to update member: "} + as_string(key) + std::string{"with uninitialized object"});
+
+                this->m_stamp = next_stamp();
+            }
+
+            std::size_t stamp() const {
+                return this->m_stamp;
             }
 
             const T& operator()(const K& key) const {
@@ -218,17 +352,18 @@ namespace Opm {
             }
 
             const T& get(const K& key) const {
-                return *this->m_data.at(key);
+                return *this->m_shards[shard_index(key)]->at(key);
             }
 
             T& get(const K& key) {
-                return *this->m_data.at(key);
+                this->m_stamp = next_stamp();
+                return *this->m_shards[shard_index(key)]->at(key);
             }
 
 
             std::vector<std::reference_wrapper<const T>> operator()() const {
                 std::vector<std::reference_wrapper<const T>> as_vector;
-                for (const auto& [_, elm_ptr] : this->m_data) {
+                for (const auto& [_, elm_ptr] : *this) {
                     (void)_;
                     as_vector.push_back( std::cref(*elm_ptr));
                 }
@@ -237,8 +372,9 @@ namespace Opm {
 
 
             std::vector<std::reference_wrapper<T>> operator()() {
+                this->m_stamp = next_stamp();
                 std::vector<std::reference_wrapper<T>> as_vector;
-                for (const auto& [_, elm_ptr] : this->m_data) {
+                for (const auto& [_, elm_ptr] : *this) {
                     (void)_;
                     as_vector.push_back( std::ref(*elm_ptr));
                 }
@@ -247,50 +383,99 @@ namespace Opm {
 
 
             bool operator==(const map_member<K,T>& other) const {
-                if (this->m_data.size() != other.m_data.size())
+                if (this->size() != other.size())
                     return false;
 
-                for (const auto& [key1, ptr1] : this->m_data) {
-                    const auto& ptr2 = other.get_ptr(key1);
-                    if (!ptr2)
-                        return false;
+                for (std::size_t index = 0; index < num_shards; ++index) {
+                    const auto& shard = this->m_shards[index];
+                    if (shard == other.m_shards[index])
+                        continue;
+
+                    for (const auto& [key1, ptr1] : *shard) {
+                        const auto& ptr2 = other.get_ptr(key1);
+                        if (!ptr2)
+                            return false;
 
-                    if (!(*ptr1 == *ptr2))
-                        return false;
+                        if ((ptr1 != ptr2) && !(*ptr1 == *ptr2))
+                            return false;
+                    }
                 }
                 return true;
             }
 
 
             std::size_t size() const {
-                return this->m_data.size();
+                std::size_t num_elements = 0;
+                for (const auto& shard : this->m_shards)
+                    num_elements += shard->size();
+
+                return num_elements;
             }
 
-            typename std::unordered_map<K, std::shared_ptr<T>>::const_iterator begin() const {
-                return this->m_data.begin();
+            const_iterator begin() const {
+                return const_iterator(this, 0);
             }
 
-            typename std::unordered_map<K, std::shared_ptr<T>>::const_iterator end() const {
-                return this->m_data.end();
+            const_iterator end() const {
+                return const_iterator(this, num_shards);
+            }
+
+            /*
+              Add the storage of the shards and elements not already seen
+              to usage.
+            */
+            void storageUsage(StorageUsage& usage) const {
+                // Approximate size of one node in the shard, i.e. the
+                // key/value pair plus the next pointer and cached hash.
+                constexpr auto node_size = sizeof(typename Shard::value_type) + 2*sizeof(void*);
+                for (const auto& shard : this->m_shards) {
+                    if (!usage.add(shard.get(), sizeof(Shard) + shard->size()*node_size
+                                   + shard->bucket_count()*sizeof(void*)))
+                        continue;
+
+                    for (const auto& [_, elm_ptr] : *shard) {
+                        (void)_;
+                        usage.add(elm_ptr.get(), sizeof(T));
+                    }
+                }
             }
 
 
             static map_member<K,T> serializationTestObject() {
                 map_member<K,T> map_object;
                 T value_object = T::serializationTestObject();
-                K key = value_object.name();
-                map_object.m_data.emplace( key, std::make_shared<T>( std::move(value_object) ));
+                map_object.update( std::move(value_object) );
                 return map_object;
             }
 
             template<class Serializer>
             void serializeOp(Serializer& serializer)
             {
-                serializer(m_data);
+                serializer(m_shards);
+                if (!serializer.isSerializing())
+                    this->m_stamp = next_stamp();
             }
 
         private:
-            std::unordered_map<K, std::shared_ptr<T>> m_data;
+            static std::size_t shard_index(const K& key) {
+                return std::hash<K>{}(key) % num_shards;
+            }
+
+            static const std::shared_ptr<Shard>& empty_shard() {
+                static const auto empty = std::make_shared<Shard>();
+                return empty;
+            }
+
+            Shard& mutable_shard(const K& key) {
+                auto& shard = this->m_shards[shard_index(key)];
+                if (shard.use_count() > 1)
+                    shard = std::make_shared<Shard>(*shard);
+
+                return *shard;
+            }
+
+            std::array<std::shared_ptr<Shard>, num_shards> m_shards;
+            std::size_t m_stamp{0};
         };
 
         struct BHPDefaults {
@@ -342,6 +527,12 @@ namespace Opm {
         bool operator==(const ScheduleState& other) const;
         static ScheduleState serializationTestObject();
 
+        /*
+          Add the storage of the shared members of this snapshot to usage,
+          keyed by member name.
+        */
+        void storageUsage(std::map<std::string, StorageUsage>& usage) const;
+
         void update_tuning(Tuning tuning);
         Tuning& tuning();
         const Tuning& tuning() const;
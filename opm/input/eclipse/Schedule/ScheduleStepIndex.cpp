@@ -0,0 +1,205 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/ScheduleStepIndex.hpp>
+
+#include <opm/input/eclipse/Schedule/Group/Group.hpp>
+#include <opm/input/eclipse/Schedule/MSW/WellSegments.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleState.hpp>
+#include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
+#include <opm/input/eclipse/Schedule/Well/Well.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
+
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+ScheduleStepIndex::ScheduleStepIndex(const ScheduleState& state)
+    : wells_stamp(state.wells.stamp())
+    , groups_stamp(state.groups.stamp())
+    , well_order_stamp(state.well_order.stamp())
+    , group_order_stamp(state.group_order.stamp())
+{
+    this->connection_offset.push_back(0);
+    this->segment_offset.push_back(0);
+
+    for (const auto& name : state.well_order().names()) {
+        const auto* well = &state.wells.get(name);
+        this->well_index.emplace(name, this->m_wells.size());
+        this->m_wells.push_back(well);
+
+        if (well->seqIndex() >= this->seq_index.size())
+            this->seq_index.resize(well->seqIndex() + 1, nullptr);
+        this->seq_index[well->seqIndex()] = well;
+
+        const auto num_segments = well->isMultiSegment() ? well->getSegments().size() : 0;
+        this->connection_offset.push_back(this->connection_offset.back() + well->getConnections().size());
+        this->segment_offset.push_back(this->segment_offset.back() + num_segments);
+    }
+
+    for (const auto& name : state.group_order().names()) {
+        this->group_index.emplace(name, this->m_groups.size());
+        this->m_groups.push_back(&state.groups.get(name));
+    }
+
+    this->child_wells.resize(this->m_groups.size());
+    std::vector<bool> done(this->m_groups.size(), false);
+    for (std::size_t index = 0; index < this->m_groups.size(); ++index)
+        this->collectChildWells(index, done);
+}
+
+const std::vector<const Well*>&
+ScheduleStepIndex::collectChildWells(std::size_t index, std::vector<bool>& done)
+{
+    auto& wells = this->child_wells[index];
+    if (done[index])
+        return wells;
+
+    done[index] = true;
+    const auto& group = *this->m_groups[index];
+    if (!group.groups().empty()) {
+        for (const auto& child_name : group.groups()) {
+            const auto child = this->groupIndex(child_name);
+            if (!child.has_value())
+                throw std::out_of_range(fmt::format("No such group: {} (child of {})",
+                                                    child_name, group.name()));
+
+            const auto& child_wells_ref = this->collectChildWells(*child, done);
+            wells.insert(wells.end(), child_wells_ref.begin(), child_wells_ref.end());
+        }
+    }
+    else {
+        for (const auto& well_name : group.wells()) {
+            const auto* well = this->findWell(well_name);
+            if (well == nullptr)
+                throw std::out_of_range(fmt::format("No such well: {} (child of {})",
+                                                    well_name, group.name()));
+
+            wells.push_back(well);
+        }
+    }
+
+    return wells;
+}
+
+bool ScheduleStepIndex::current(const ScheduleState& state) const
+{
+    return (this->wells_stamp == state.wells.stamp())
+        && (this->groups_stamp == state.groups.stamp())
+        && (this->well_order_stamp == state.well_order.stamp())
+        && (this->group_order_stamp == state.group_order.stamp());
+}
+
+std::size_t ScheduleStepIndex::numWells() const
+{
+    return this->m_wells.size();
+}
+
+const std::vector<const Well*>& ScheduleStepIndex::wells() const
+{
+    return this->m_wells;
+}
+
+const Well& ScheduleStepIndex::well(std::size_t index) const
+{
+    return *this->m_wells.at(index);
+}
+
+std::optional<std::size_t> ScheduleStepIndex::wellIndex(const std::string& name) const
+{
+    auto iter = this->well_index.find(name);
+    if (iter == this->well_index.end())
+        return {};
+
+    return iter->second;
+}
+
+const Well* ScheduleStepIndex::findWell(const std::string& name) const
+{
+    const auto index = this->wellIndex(name);
+    return index.has_value() ? this->m_wells[*index] : nullptr;
+}
+
+const Well* ScheduleStepIndex::findWellBySeqIndex(std::size_t seq_index_arg) const
+{
+    return (seq_index_arg < this->seq_index.size()) ? this->seq_index[seq_index_arg] : nullptr;
+}
+
+std::size_t ScheduleStepIndex::numGroups() const
+{
+    return this->m_groups.size();
+}
+
+const std::vector<const Group*>& ScheduleStepIndex::groups() const
+{
+    return this->m_groups;
+}
+
+const Group& ScheduleStepIndex::group(std::size_t index) const
+{
+    return *this->m_groups.at(index);
+}
+
+std::optional<std::size_t> ScheduleStepIndex::groupIndex(const std::string& name) const
+{
+    auto iter = this->group_index.find(name);
+    if (iter == this->group_index.end())
+        return {};
+
+    return iter->second;
+}
+
+const Group* ScheduleStepIndex::findGroup(const std::string& name) const
+{
+    const auto index = this->groupIndex(name);
+    return index.has_value() ? this->m_groups[*index] : nullptr;
+}
+
+const std::vector<const Well*>& ScheduleStepIndex::childWells(std::size_t index) const
+{
+    return this->child_wells.at(index);
+}
+
+std::size_t ScheduleStepIndex::connectionOffset(std::size_t well_index_arg) const
+{
+    return this->connection_offset.at(well_index_arg);
+}
+
+std::size_t ScheduleStepIndex::numConnections() const
+{
+    return this->connection_offset.back();
+}
+
+std::size_t ScheduleStepIndex::segmentOffset(std::size_t well_index_arg) const
+{
+    return this->segment_offset.at(well_index_arg);
+}
+
+std::size_t ScheduleStepIndex::numSegments() const
+{
+    return this->segment_offset.back();
+}
+
+}
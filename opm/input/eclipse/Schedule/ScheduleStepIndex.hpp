@@ -0,0 +1,108 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SCHEDULE_STEP_INDEX_HPP
+#define SCHEDULE_STEP_INDEX_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm {
+
+class Group;
+class ScheduleState;
+class Well;
+
+/*
+  The ScheduleStepIndex class is a dense, read-only view of the wells and
+  groups of one report step. Wells and groups are numbered in insertion
+  order, i.e. the order of ScheduleState::well_order() and
+  ScheduleState::group_order(), and all queries are served from contiguous
+  arrays without copying Well or Group objects.
+
+  The connections and segments of all wells are numbered consecutively in
+  well order, so the connections of the well with index i occupy the range
+  [connectionOffset(i), connectionOffset(i + 1)) of such a flattened
+  numbering.
+
+  The index holds plain pointers into the ScheduleState it was created
+  from. Use current() to check whether the index still describes a
+  particular ScheduleState; Schedule::stepIndex() does this automatically.
+*/
+
+class ScheduleStepIndex {
+public:
+    explicit ScheduleStepIndex(const ScheduleState& state);
+
+    /// Whether the wells and groups of \p state are exactly those this
+    /// index was created from.
+    bool current(const ScheduleState& state) const;
+
+    std::size_t numWells() const;
+    const std::vector<const Well*>& wells() const;
+    const Well& well(std::size_t index) const;
+    std::optional<std::size_t> wellIndex(const std::string& name) const;
+    const Well* findWell(const std::string& name) const;
+
+    /// Well with Well::seqIndex() == \p seq_index, or nullptr.
+    const Well* findWellBySeqIndex(std::size_t seq_index) const;
+
+    std::size_t numGroups() const;
+    const std::vector<const Group*>& groups() const;
+    const Group& group(std::size_t index) const;
+    std::optional<std::size_t> groupIndex(const std::string& name) const;
+    const Group* findGroup(const std::string& name) const;
+
+    /// Wells at the bottom of the group tree below the group with index
+    /// \p index, in the order used by Schedule::getChildWells2().
+    const std::vector<const Well*>& childWells(std::size_t index) const;
+
+    std::size_t connectionOffset(std::size_t well_index) const;
+    std::size_t numConnections() const;
+    std::size_t segmentOffset(std::size_t well_index) const;
+    std::size_t numSegments() const;
+
+private:
+    std::size_t wells_stamp{0};
+    std::size_t groups_stamp{0};
+    std::size_t well_order_stamp{0};
+    std::size_t group_order_stamp{0};
+
+    std::vector<const Well*> m_wells;
+    std::unordered_map<std::string, std::size_t> well_index;
+    std::vector<const Well*> seq_index;
+
+    std::vector<const Group*> m_groups;
+    std::unordered_map<std::string, std::size_t> group_index;
+    std::vector<std::vector<const Well*>> child_wells;
+
+    // One element more than the number of wells.
+    std::vector<std::size_t> connection_offset;
+    std::vector<std::size_t> segment_offset;
+
+    const std::vector<const Well*>& collectChildWells(std::size_t index,
+                                                      std::vector<bool>& done);
+};
+
+}
+
+#endif
@@ -152,6 +152,29 @@ namespace {
         }
     }
 
+    // Assign, or for totals accumulate, value to map[key].  Returns whether
+    // the stored value changed, including the creation of the entry.
+    template <typename Map, typename Key>
+    bool update_value(Map& map, const Key& key, const bool total, const double value)
+    {
+        const auto size = map.size();
+        auto& val_ref = map[key];
+        const auto prev = val_ref;
+
+        if (total) {
+            val_ref += value;
+        }
+        else {
+            val_ref = value;
+        }
+
+        return (map.size() != size) || !(val_ref == prev);
+    }
+
+    // Change stamp key of the well and group name sets.  Not a valid
+    // summary vector name.
+    const std::string names_stamp_key { ":NAMES" };
+
     template <class T>
     std::vector<std::string>
     var2_list(const map2<T>& values, const std::string& var1)
@@ -224,11 +247,18 @@ namespace Opm
 
     void SummaryState::set(const std::string& key, double value)
     {
-        this->values.insert_or_assign(key, value);
+        if (update_value(this->values, key, false, value)) {
+            this->change_stamps.touch(key);
+        }
     }
 
     bool SummaryState::erase(const std::string& key) {
-        return (this->values.erase(key) > 0);
+        if (this->values.erase(key) == 0) {
+            return false;
+        }
+
+        this->change_stamps.touch(key);
+        return true;
     }
 
     bool SummaryState::erase_well_var(const std::string& well, const std::string& var)
@@ -239,6 +269,8 @@ namespace Opm
 
         erase_var(this->well_values, this->m_wells, var, well);
         this->well_names.reset();
+        this->change_stamps.touch(var);
+        this->change_stamps.touch(names_stamp_key);
         return true;
     }
 
@@ -250,6 +282,8 @@ namespace Opm
 
         erase_var(this->group_values, this->m_groups, var, group);
         this->group_names.reset();
+        this->change_stamps.touch(var);
+        this->change_stamps.touch(names_stamp_key);
         return true;
     }
 
@@ -341,13 +375,8 @@ namespace Opm
 
     void SummaryState::update(const std::string& key, double value)
     {
-        auto& val_ref = this->values[key];
-
-        if (is_total(key)) {
-            val_ref += value;
-        }
-        else {
-            val_ref = value;
+        if (update_value(this->values, key, is_total(key), value)) {
+            this->change_stamps.touch(key);
         }
     }
 
@@ -355,20 +384,16 @@ namespace Opm
                                        const std::string& var,
                                        const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, well)];
-        auto& wval_ref = this->well_values[var][well];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            wval_ref += value;
-        }
-        else {
-            val_ref = wval_ref = value;
+        const auto total = is_total(var);
+        update_value(this->values, fmt::format("{}:{}", var, well), total, value);
+        if (update_value(this->well_values[var], well, total, value)) {
+            this->change_stamps.touch(var);
         }
 
         if (this->m_wells.count(well) == 0) {
             this->m_wells.insert(well);
             this->well_names.reset();
+            this->change_stamps.touch(names_stamp_key);
         }
     }
 
@@ -376,20 +401,16 @@ namespace Opm
                                         const std::string& var,
                                         const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, group)];
-        auto& gval_ref = this->group_values[var][group];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            gval_ref += value;
-        }
-        else {
-            val_ref = gval_ref = value;
+        const auto total = is_total(var);
+        update_value(this->values, fmt::format("{}:{}", var, group), total, value);
+        if (update_value(this->group_values[var], group, total, value)) {
+            this->change_stamps.touch(var);
         }
 
         if (this->m_groups.count(group) == 0) {
             this->m_groups.insert(group);
             this->group_names.reset();
+            this->change_stamps.touch(names_stamp_key);
         }
     }
 
@@ -430,15 +451,10 @@ namespace Opm
                                        const std::size_t  global_index,
                                        const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}:{}", var, well, global_index)];
-        auto& cval_ref = this->conn_values[var][well][global_index];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            cval_ref += value;
-        }
-        else {
-            val_ref = cval_ref = value;
+        const auto total = is_total(var);
+        update_value(this->values, fmt::format("{}:{}:{}", var, well, global_index), total, value);
+        if (update_value(this->conn_values[var][well], global_index, total, value)) {
+            this->change_stamps.touch(var);
         }
     }
 
@@ -447,15 +463,10 @@ namespace Opm
                                           const std::size_t  segment,
                                           const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}:{}", var, well, segment)];
-        auto& sval_ref = this->segment_values[var][well][segment];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            sval_ref += value;
-        }
-        else {
-            val_ref = sval_ref = value;
+        const auto total = is_total(var);
+        update_value(this->values, fmt::format("{}:{}:{}", var, well, segment), total, value);
+        if (update_value(this->segment_values[var][well], segment, total, value)) {
+            this->change_stamps.touch(var);
         }
     }
 
@@ -466,15 +477,10 @@ namespace Opm
     {
         const auto regKw = EclIO::SummaryNode::normalise_region_keyword(var);
 
-        auto& val_ref  = this->values[region_key(regKw, regSet, region)];
-        auto& rval_ref = this->region_values[regKw][normalise_region_set_name(regSet)][region];
-
-        if (is_total(regKw)) {
-            val_ref  += value;
-            rval_ref += value;
-        }
-        else {
-            val_ref = rval_ref = value;
+        const auto total = is_total(regKw);
+        update_value(this->values, region_key(regKw, regSet, region), total, value);
+        if (update_value(this->region_values[regKw][normalise_region_set_name(regSet)], region, total, value)) {
+            this->change_stamps.touch(regKw);
         }
     }
 
@@ -832,6 +838,8 @@ namespace Opm
         for (const auto& [var, vals] : buffer.segment_values) {
             this->segment_values.insert_or_assign(var, vals);
         }
+
+        this->change_stamps.touch_all();
     }
 
     SummaryState::const_iterator SummaryState::begin() const
@@ -849,6 +857,16 @@ namespace Opm
         return this->m_wells.size();
     }
 
+    std::size_t SummaryState::change_stamp(const std::string& var) const
+    {
+        return this->change_stamps.get(var);
+    }
+
+    std::size_t SummaryState::names_change_stamp() const
+    {
+        return this->change_stamps.get(names_stamp_key);
+    }
+
     std::size_t SummaryState::size() const
     {
         return this->values.size();
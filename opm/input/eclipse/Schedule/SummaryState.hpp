@@ -22,6 +22,8 @@
 
 #include <opm/common/utility/TimeService.hpp>
 
+#include <opm/input/eclipse/Schedule/ChangeStamps.hpp>
+
 #include <cstddef>
 #include <ctime>
 #include <iosfwd>
@@ -133,6 +135,14 @@ public:
     const_iterator begin() const;
     const_iterator end() const;
     std::size_t num_wells() const;
+
+    // Stamp of the last change to the values of the variable 'var', e.g.
+    // "FOPR", or "WOPR" for all wells.  Assignments which leave a value
+    // unchanged are not changes.  See ChangeStamps for comparing stamps.
+    std::size_t change_stamp(const std::string& var) const;
+
+    // Stamp of the last change to the sets of well and group names.
+    std::size_t names_change_stamp() const;
     std::size_t size() const;
     bool operator==(const SummaryState& other) const;
 
@@ -152,6 +162,10 @@ public:
         serializer(conn_values);
         serializer(segment_values);
         serializer(this->region_values);
+
+        if (!serializer.isSerializing()) {
+            this->change_stamps.touch_all();
+        }
     }
 
     static SummaryState serializationTestObject();
@@ -183,6 +197,9 @@ private:
     // First key is variable (e.g., ROIP), second key is region set (e.g.,
     // FIPNUM, FIPABC), and the third key is the one-based region number.
     std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> region_values;
+
+    // Keyed by variable.  Not serialized or compared.
+    ChangeStamps change_stamps{};
 };
 
 std::ostream& operator<<(std::ostream& stream, const SummaryState& st);
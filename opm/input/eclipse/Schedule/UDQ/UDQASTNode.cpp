@@ -23,15 +23,18 @@
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDT.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <set>
 #include <stdexcept>
 #include <string>
 #include <tuple>
 #include <unordered_set>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -60,6 +63,42 @@ bool is_udq(const std::string& keyword)
         && (keyword.find_first_of("WGFCRBSA") == sz_t{0});
 }
 
+// Apply the node's sign in place rather than through operator*(), which
+// would copy the whole set.
+Opm::UDQSet apply_sign(Opm::UDQSet&& result, const double sign)
+{
+    if (sign != 1.0) {
+        result *= sign;
+    }
+
+    return std::move(result);
+}
+
+// Assign values to the elements of 'result' named in 'names', which must
+// appear in the same relative order as the elements of 'result'.  This
+// holds for all well and group lists produced by the UDQContext.
+template <typename ValueFunc>
+void assign_ordered(Opm::UDQSet&                    result,
+                    const std::vector<std::string>& names,
+                    ValueFunc&&                     value)
+{
+    auto index = std::size_t{0};
+    for (const auto& name : names) {
+        while ((index < result.size()) && (result[index].wgname() != name)) {
+            ++index;
+        }
+
+        if (index == result.size()) {
+            // Not in the expected order.  Fall back to name lookup.
+            result.assign(name, value(name));
+            index = 0;
+            continue;
+        }
+
+        result.assign(index++, value(name));
+    }
+}
+
 Opm::UDQVarType init_type(const Opm::UDQTokenType token_type)
 {
     if ((token_type == Opm::UDQTokenType::number) ||
@@ -180,23 +219,23 @@ UDQASTNode::eval(const UDQVarType  target_type,
                  const UDQContext& context) const
 {
     if (this->type == UDQTokenType::ecl_expr) {
-        return this->sign * this->eval_expression(context);
+        return apply_sign(this->eval_expression(context), this->sign);
     }
 
     if (UDQ::scalarFunc(this->type)) {
-        return this->sign * this->eval_scalar_function(target_type, context);
+        return apply_sign(this->eval_scalar_function(target_type, context), this->sign);
     }
 
     if (UDQ::elementalUnaryFunc(this->type)) {
-        return this->sign * this->eval_elemental_unary_function(target_type, context);
+        return apply_sign(this->eval_elemental_unary_function(target_type, context), this->sign);
     }
 
     if (UDQ::binaryFunc(this->type)) {
-        return this->sign * this->eval_binary_function(target_type, context);
+        return apply_sign(this->eval_binary_function(target_type, context), this->sign);
     }
 
     if (this->type == UDQTokenType::number) {
-        return this->sign * this->eval_number(target_type, context);
+        return apply_sign(this->eval_number(target_type, context), this->sign);
     }
 
     throw std::invalid_argument {
@@ -204,6 +243,82 @@ UDQASTNode::eval(const UDQVarType  target_type,
     };
 }
 
+bool UDQASTNode::compile(UDQProgram& program) const
+{
+    using OpCode = UDQProgram::OpCode;
+
+    if (this->type == UDQTokenType::number) {
+        program.append({ OpCode::Number, std::get<double>(this->value) });
+    }
+    else if (this->type == UDQTokenType::ecl_expr) {
+        const auto& string_value = std::get<std::string>(this->value);
+        const auto data_type = UDQ::targetType(string_value);
+
+        if (data_type == UDQVarType::WELL_VAR) {
+            if (this->selector.empty()) {
+                program.append({ OpCode::WellVar, 0.0, string_value });
+            }
+            else if (this->selector.front().find('*') == std::string::npos) {
+                program.append({ OpCode::WellVarSingle, 0.0, string_value, this->selector.front() });
+            }
+            else {
+                program.append({ OpCode::WellVarPattern, 0.0, string_value, this->selector.front() });
+            }
+        }
+        else if (data_type == UDQVarType::GROUP_VAR) {
+            if (this->selector.empty()) {
+                program.append({ OpCode::GroupVar, 0.0, string_value });
+            }
+            else if (this->selector.front().find('*') == std::string::npos) {
+                program.append({ OpCode::GroupVarSingle, 0.0, string_value, this->selector.front() });
+            }
+            else {
+                return false;
+            }
+        }
+        else if (data_type == UDQVarType::FIELD_VAR) {
+            program.append({ OpCode::FieldVar, 0.0, string_value });
+        }
+        else if ((data_type == UDQVarType::SEGMENT_VAR) ||
+                 (data_type == UDQVarType::REGION_VAR) ||
+                 (data_type == UDQVarType::TABLE_LOOKUP))
+        {
+            return false;
+        }
+        else {
+            program.append({ OpCode::Scalar, 0.0, string_value });
+        }
+    }
+    else if ((this->type == UDQTokenType::binary_op_add) ||
+             (this->type == UDQTokenType::binary_op_sub) ||
+             (this->type == UDQTokenType::binary_op_mul) ||
+             (this->type == UDQTokenType::binary_op_div))
+    {
+        if (! this->left || ! this->right ||
+            ! this->left->compile(program) ||
+            ! this->right->compile(program))
+        {
+            return false;
+        }
+
+        const auto op = (this->type == UDQTokenType::binary_op_add) ? OpCode::Add
+            : (this->type == UDQTokenType::binary_op_sub) ? OpCode::Sub
+            : (this->type == UDQTokenType::binary_op_mul) ? OpCode::Mul
+            : OpCode::Div;
+
+        program.append({ op });
+    }
+    else {
+        return false;
+    }
+
+    if (this->sign != 1.0) {
+        program.append({ OpCode::Scale, this->sign });
+    }
+
+    return true;
+}
+
 bool UDQASTNode::valid() const
 {
     return this->type != UDQTokenType::error;
@@ -353,8 +468,8 @@ UDQASTNode::eval_well_expression(const std::string& string_value,
     if (this->selector.empty()) {
         auto res = UDQSet::wells(string_value, all_wells);
 
-        for (const auto& well : all_wells) {
-            res.assign(well, context.get_well_var(well, string_value));
+        for (auto index = 0*all_wells.size(); index < all_wells.size(); ++index) {
+            res.assign(index, context.get_well_var(all_wells[index], string_value));
         }
 
         return res;
@@ -374,9 +489,9 @@ UDQASTNode::eval_well_expression(const std::string& string_value,
         // updated for all wells in the right hand set, wells missing in the
         // right hand set will be undefined in the result set.
         auto res = UDQSet::wells(string_value, all_wells);
-        for (const auto& wname : context.wells(well_pattern)) {
-            res.assign(wname, context.get_well_var(wname, string_value));
-        }
+        assign_ordered(res, context.wells(well_pattern),
+                       [&context, &string_value](const std::string& wname)
+                       { return context.get_well_var(wname, string_value); });
 
         return res;
     }
@@ -398,8 +513,8 @@ UDQASTNode::eval_group_expression(const std::string& string_value,
     const auto& groups = context.groups();
 
     auto res = UDQSet::groups(string_value, groups);
-    for (const auto& group : groups) {
-        res.assign(group, context.get_group_var(group, string_value));
+    for (auto index = 0*groups.size(); index < groups.size(); ++index) {
+        res.assign(index, context.get_group_var(groups[index], string_value));
     }
 
     return res;
@@ -602,11 +717,12 @@ UDQASTNode::eval_table_lookup_group(const std::string& string_value,
                                     const UDQContext& context) const
 {
     const UDT& udt = context.get_udt(string_value);
-    UDQSet result = UDQSet::groups("dummy", context.groups());
-    for (const auto& group : context.groups()) {
-        const auto xvar = context.get_group_var(group, this->selector[0]);
+    const auto& groups = context.groups();
+    UDQSet result = UDQSet::groups("dummy", groups);
+    for (auto index = 0*groups.size(); index < groups.size(); ++index) {
+        const auto xvar = context.get_group_var(groups[index], this->selector[0]);
         if (xvar.has_value()) {
-            result.assign(group, udt(*xvar));
+            result.assign(index, udt(*xvar));
         }
     }
 
@@ -642,11 +758,12 @@ UDQASTNode::eval_table_lookup_well(const std::string& string_value,
                                    const UDQContext& context) const
 {
     const UDT& udt = context.get_udt(string_value);
-    UDQSet result = UDQSet::wells("dummy", context.wells());
-    for (const auto& well : context.wells()) {
-        const auto xvar = context.get_well_var(well, this->selector[0]);
+    const auto& wells = context.wells();
+    UDQSet result = UDQSet::wells("dummy", wells);
+    for (auto index = 0*wells.size(); index < wells.size(); ++index) {
+        const auto xvar = context.get_well_var(wells[index], this->selector[0]);
         if (xvar.has_value()) {
-            result.assign(well, udt(*xvar));
+            result.assign(index, udt(*xvar));
         }
     }
 
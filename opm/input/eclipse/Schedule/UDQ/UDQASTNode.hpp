@@ -33,6 +33,8 @@
 
 namespace Opm {
 
+class UDQProgram;
+
 class UDQASTNode
 {
 public:
@@ -61,6 +63,12 @@ public:
     static UDQASTNode serializationTestObject();
 
     UDQSet eval(UDQVarType eval_target, const UDQContext& context) const;
+
+    /// Append the instructions evaluating this node to \p program.
+    /// Returns false if the node, or one of its children, cannot be
+    /// compiled.
+    bool compile(UDQProgram& program) const;
+
     bool valid() const;
     std::set<UDQTokenType> func_tokens() const;
 
@@ -41,17 +41,26 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <exception>
 #include <functional>
+#include <iterator>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include <fmt/format.h>
 
 namespace {
+    // Independent DEFINE statements are evaluated in parallel only for
+    // levels with enough statements to amortise the thread start-up cost.
+    constexpr std::size_t minParallelDefines = 8;
+
     std::string strip_quotes(const std::string& s)
     {
         if (s[0] == '\'') {
@@ -138,6 +147,155 @@ namespace {
 
         EvalAssign(Create create) : create_{ std::move(create) } {}
     };
+
+    bool uses_random_numbers(const Opm::UDQDefine& def)
+    {
+        const auto func_tokens = def.func_tokens();
+
+        return std::any_of(func_tokens.begin(), func_tokens.end(),
+                           [](const Opm::UDQTokenType type)
+                           {
+                               return (type == Opm::UDQTokenType::elemental_func_randn)
+                                   || (type == Opm::UDQTokenType::elemental_func_randu)
+                                   || (type == Opm::UDQTokenType::elemental_func_rrandn)
+                                   || (type == Opm::UDQTokenType::elemental_func_rrandu);
+                           });
+    }
+
+    // Names of the UDQs and summary vectors read by a DEFINE statement,
+    // including the UDQ it defines.  Nullopt if the statement draws random
+    // numbers or reads values without change stamps, i.e., segment,
+    // region or table lookup values, and must always be evaluated.
+    std::optional<std::vector<std::string>>
+    tracked_inputs(const Opm::UDQDefine& def)
+    {
+        if ((def.var_type() == Opm::UDQVarType::SEGMENT_VAR) ||
+            uses_random_numbers(def))
+        {
+            return std::nullopt;
+        }
+
+        auto inputs = std::vector<std::string> { def.keyword() };
+        for (const auto& token : def.tokens()) {
+            if ((token.type() != Opm::UDQTokenType::ecl_expr) ||
+                ! std::holds_alternative<std::string>(token.value()))
+            {
+                continue;
+            }
+
+            const auto& name = std::get<std::string>(token.value());
+            switch (Opm::UDQ::targetType(name)) {
+            case Opm::UDQVarType::NONE:
+            case Opm::UDQVarType::SCALAR:
+            case Opm::UDQVarType::FIELD_VAR:
+            case Opm::UDQVarType::WELL_VAR:
+            case Opm::UDQVarType::GROUP_VAR:
+                inputs.push_back(name);
+                break;
+
+            default:
+                return std::nullopt;
+            }
+        }
+
+        return inputs;
+    }
+
+    // Group DEFINE statements, given in input order, into evaluation
+    // levels.  All statements on a single level are independent of each
+    // other and may be evaluated concurrently, provided the levels are
+    // processed in increasing order.
+    //
+    // Statement j is placed on a level after statement i < j if
+    //
+    //   1. j reads the quantity defined by i, or
+    //   2. i reads the quantity defined by j--i.e., i must see the value
+    //      from before j is evaluated, or
+    //   3. both draw random numbers, which come from a shared generator and
+    //      must be drawn in input order, or
+    //   4. both need the segment or region set matchers, which the
+    //      evaluation context creates on first use.
+    std::vector<std::vector<std::size_t>>
+    evaluation_levels(const std::vector<const Opm::UDQDefine*>& defines)
+    {
+        auto position = std::unordered_map<std::string, std::size_t>{};
+        for (auto i = 0*defines.size(); i < defines.size(); ++i) {
+            position.emplace(defines[i]->keyword(), i);
+        }
+
+        auto level = std::vector<std::size_t>(defines.size(), 0);
+        auto earlier_readers = std::vector<std::vector<std::size_t>>(defines.size());
+        auto prev_random = std::optional<std::size_t>{};
+        auto prev_matcher = std::optional<std::size_t>{};
+
+        auto after = [&level](const std::size_t j, const std::size_t i)
+        {
+            level[j] = std::max(level[j], level[i] + 1);
+        };
+
+        for (auto j = 0*defines.size(); j < defines.size(); ++j) {
+            for (const auto i : earlier_readers[j]) {
+                after(j, i);
+            }
+
+            auto uses_matcher = defines[j]->var_type() == Opm::UDQVarType::SEGMENT_VAR;
+
+            for (const auto& token : defines[j]->tokens()) {
+                if ((token.type() != Opm::UDQTokenType::ecl_expr) ||
+                    ! std::holds_alternative<std::string>(token.value()))
+                {
+                    continue;
+                }
+
+                const auto& name = std::get<std::string>(token.value());
+
+                const auto target = Opm::UDQ::targetType(name);
+                uses_matcher = uses_matcher
+                    || (target == Opm::UDQVarType::SEGMENT_VAR)
+                    || (target == Opm::UDQVarType::REGION_VAR)
+                    || (target == Opm::UDQVarType::TABLE_LOOKUP);
+
+                const auto pos = position.find(name);
+                if ((pos == position.end()) || (pos->second == j)) {
+                    continue;
+                }
+
+                if (pos->second < j) {
+                    after(j, pos->second);
+                }
+                else {
+                    earlier_readers[pos->second].push_back(j);
+                }
+            }
+
+            if (uses_random_numbers(*defines[j])) {
+                if (prev_random.has_value()) {
+                    after(j, *prev_random);
+                }
+
+                prev_random = j;
+            }
+
+            if (uses_matcher) {
+                if (prev_matcher.has_value()) {
+                    after(j, *prev_matcher);
+                }
+
+                prev_matcher = j;
+            }
+        }
+
+        auto levels = std::vector<std::vector<std::size_t>>{};
+        for (auto j = 0*defines.size(); j < defines.size(); ++j) {
+            if (level[j] >= levels.size()) {
+                levels.resize(level[j] + 1);
+            }
+
+            levels[level[j]].push_back(j);
+        }
+
+        return levels;
+    }
 } // Anonymous namespace
 
 namespace Opm {
@@ -653,7 +811,7 @@ namespace Opm {
     }
 
     void UDQConfig::eval_define(const std::size_t report_step,
-                                const UDQState&   udq_state,
+                                UDQState&         udq_state,
                                 UDQContext&       context) const
     {
         auto var_type_bit = [](const UDQVarType var_type)
@@ -667,6 +825,7 @@ namespace Opm {
         select_var_type |= var_type_bit(UDQVarType::FIELD_VAR);
         select_var_type |= var_type_bit(UDQVarType::SEGMENT_VAR);
 
+        auto defines = std::vector<const UDQDefine*>{};
         for (const auto& [keyword, index] : this->input_index) {
             if (index.action != UDQAction::DEFINE) {
                 continue;
@@ -687,7 +846,100 @@ namespace Opm {
                 continue;
             }
 
-            context.update_define(report_step, keyword, def.eval(context));
+            defines.push_back(&def);
+        }
+
+        if (defines.size() > 1) {
+            // Populate lazily computed group name list ahead of any
+            // concurrent evaluation.
+            context.groups();
+        }
+
+        // A statement is skipped if none of its inputs, nor the group
+        // list, has changed since it was last evaluated in this report
+        // step.  The well list is fixed within a report step.  The newest
+        // input stamp is recorded after publishing the result, so changes
+        // to inputs published later in this pass, e.g., by a later
+        // statement, cause a new evaluation in the next pass.
+        auto inputs = std::vector<std::optional<std::vector<std::string>>>(defines.size());
+        std::transform(defines.begin(), defines.end(), inputs.begin(),
+                       [](const UDQDefine* def) { return tracked_inputs(*def); });
+
+        auto input_stamp = [&context, &inputs](const std::size_t i)
+        {
+            auto stamp = std::optional<std::size_t>{};
+            if (inputs[i].has_value()) {
+                stamp = context.names_change_stamp();
+                for (const auto& input : *inputs[i]) {
+                    stamp = std::max(*stamp, context.change_stamp(input));
+                }
+            }
+
+            return stamp;
+        };
+
+        auto publish = [report_step, &context, &udq_state, &defines, &input_stamp]
+            (const std::size_t i, const UDQSet& result)
+        {
+            context.update_define(report_step, defines[i]->keyword(), result);
+
+            if (const auto stamp = input_stamp(i); stamp.has_value()) {
+                udq_state.record_define_inputs(defines[i]->keyword(), report_step, *stamp);
+            }
+        };
+
+        for (const auto& all_statements : evaluation_levels(defines)) {
+            // Decided per level, as earlier levels may have changed the
+            // inputs.
+            auto level = std::vector<std::size_t>{};
+            std::copy_if(all_statements.begin(), all_statements.end(), std::back_inserter(level),
+                         [report_step, &udq_state, &defines, &input_stamp](const std::size_t i)
+                         {
+                             const auto stamp = input_stamp(i);
+                             return ! stamp.has_value()
+                                 || ! udq_state.define_inputs_unchanged(defines[i]->keyword(),
+                                                                        report_step, *stamp);
+                         });
+
+            if (level.empty()) {
+                continue;
+            }
+
+            if (level.size() == 1) {
+                publish(level.front(), defines[level.front()]->eval(context));
+                continue;
+            }
+
+            // Statements on the same level only read values published by
+            // earlier levels.  Evaluate concurrently, then publish results
+            // in input order.  Errors are logged when publishing, as the
+            // logger is not thread safe, and only for the first failing
+            // statement, as in sequential evaluation.
+            auto results = std::vector<std::optional<UDQSet>>(level.size());
+            auto errors = std::vector<std::exception_ptr>(level.size());
+
+#pragma omp parallel for schedule(static) if (level.size() >= minParallelDefines)
+            for (std::size_t i = 0; i < level.size(); ++i) {
+                try {
+                    results[i] = defines[level[i]]->eval_unreported(context);
+                }
+                catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+
+            for (std::size_t i = 0; i < level.size(); ++i) {
+                if (errors[i]) {
+                    try {
+                        std::rethrow_exception(errors[i]);
+                    }
+                    catch (const std::exception& exc) {
+                        defines[level[i]]->report_error(exc);
+                    }
+                }
+
+                publish(level[i], *results[i]);
+            }
         }
     }
 
@@ -526,17 +526,20 @@ namespace Opm {
         /// Compute new values for all UDQs
         ///
         /// Evaluates all applicable defining expressions.  Assigns new UDQ
-        /// values to both the summary and UDQ state objects.
+        /// values to both the summary and UDQ state objects.  Expressions
+        /// whose inputs are unchanged since their last evaluation in the
+        /// same report step keep their current values.
         ///
         /// \param[in] report_step Current report step.
         ///
-        /// \param[in] schedule Full dynamic input schedule.
+        /// \param[in,out] udq_state Dynamic UDQ values and the record of
+        /// the inputs of each evaluated expression.
         ///
         /// \param[in,out] context Pattern matchers and state objects.
         /// Values pertaining to UDQs being evaluated here will be updated.
-        void eval_define(std::size_t     report_step,
-                         const UDQState& udq_state,
-                         UDQContext&     context) const;
+        void eval_define(std::size_t report_step,
+                         UDQState&   udq_state,
+                         UDQContext& context) const;
 
         /// Incorporate an enumerated assignment statement into known UDQ
         /// collection.
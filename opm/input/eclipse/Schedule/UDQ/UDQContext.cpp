@@ -207,7 +207,7 @@ namespace Opm {
         return it->second;
     }
 
-    std::vector<std::string> UDQContext::wells() const
+    const std::vector<std::string>& UDQContext::wells() const
     {
         return this->well_matcher.wells();
     }
@@ -217,11 +217,23 @@ namespace Opm {
         return this->well_matcher.wells(pattern);
     }
 
-    std::vector<std::string> UDQContext::groups() const
+    const std::vector<std::string>& UDQContext::groups() const
     {
         return this->summary_state.groups();
     }
 
+    std::size_t UDQContext::change_stamp(const std::string& key) const
+    {
+        return is_udq(key)
+            ? this->udq_state.change_stamp(key)
+            : this->summary_state.change_stamp(key);
+    }
+
+    std::size_t UDQContext::names_change_stamp() const
+    {
+        return this->summary_state.names_change_stamp();
+    }
+
     SegmentSet UDQContext::segments() const
     {
         // Empty descriptor matches all segments in all existing MS wells.
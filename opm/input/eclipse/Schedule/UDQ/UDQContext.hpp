@@ -89,9 +89,14 @@ namespace Opm {
 
         const UDQFunctionTable& function_table() const;
 
-        std::vector<std::string> wells() const;
+        // Change stamps of the values read by get() and friends for the
+        // UDQ or summary vector 'key', and of the group list.
+        std::size_t change_stamp(const std::string& key) const;
+        std::size_t names_change_stamp() const;
+
+        const std::vector<std::string>& wells() const;
         std::vector<std::string> wells(const std::string& pattern) const;
-        std::vector<std::string> groups() const;
+        const std::vector<std::string>& groups() const;
         SegmentSet segments() const;
         SegmentSet segments(const std::vector<std::string>& set_descriptor) const;
 
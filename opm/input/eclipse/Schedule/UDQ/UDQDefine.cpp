@@ -284,6 +284,15 @@ UDQDefine::UDQDefine(const UDQParams&                udq_params,
                                    this->m_tokens,
                                    parseContext,
                                    errors);
+    this->compile();
+}
+
+void UDQDefine::compile()
+{
+    this->program.reset();
+    if (this->ast != nullptr) {
+        this->program = UDQProgram::compile(*this->ast, this->m_var_type);
+    }
 }
 
 void UDQDefine::update_status(const UDQUpdate   update,
@@ -314,32 +323,32 @@ void UDQDefine::required_summary(std::unordered_set<std::string>& summary_keys)
 
 UDQSet UDQDefine::eval(const UDQContext& context) const
 {
-    auto res = std::optional<UDQSet>{};
     try {
-        res = this->ast->eval(this->m_var_type, context);
-        res->name(this->m_keyword);
-
-        if (! dynamic_type_check(this->var_type(), res->var_type())) {
-            throw std::invalid_argument {
-                "Invalid runtime type conversion "
-                "detected when evaluating UDQ " + this->m_keyword
-            };
-        }
+        return this->eval_unreported(context);
     }
     catch (const std::exception& exc) {
-        const auto msg = fmt::format("Problem evaluating UDQ {}\n"
-                                     "In {} line {}\n"
-                                     "Internal error: {}",
-                                     this->m_keyword,
-                                     this->m_location.filename,
-                                     this->m_location.lineno,
-                                     exc.what());
-        OpmLog::error(msg);
-        std::throw_with_nested(exc);
+        this->report_error(exc);
+    }
+}
+
+UDQSet UDQDefine::eval_unreported(const UDQContext& context) const
+{
+    auto res = std::optional<UDQSet>{};
+    if (this->program.has_value()) {
+        res = this->program->eval(this->m_keyword, context);
     }
 
     if (! res.has_value()) {
-        throw std::logic_error("Bug in UDQDefine::eval()");
+        res = this->ast->eval(this->m_var_type, context);
+    }
+
+    res->name(this->m_keyword);
+
+    if (! dynamic_type_check(this->var_type(), res->var_type())) {
+        throw std::invalid_argument {
+            "Invalid runtime type conversion "
+            "detected when evaluating UDQ " + this->m_keyword
+        };
     }
 
     if (res->var_type() == UDQVarType::SCALAR) {
@@ -349,6 +358,19 @@ UDQSet UDQDefine::eval(const UDQContext& context) const
     return *std::move(res);
 }
 
+void UDQDefine::report_error(const std::exception& exc) const
+{
+    const auto msg = fmt::format("Problem evaluating UDQ {}\n"
+                                 "In {} line {}\n"
+                                 "Internal error: {}",
+                                 this->m_keyword,
+                                 this->m_location.filename,
+                                 this->m_location.lineno,
+                                 exc.what());
+    OpmLog::error(msg);
+    std::throw_with_nested(exc);
+}
+
 const KeywordLocation& UDQDefine::location() const
 {
     return this->m_location;
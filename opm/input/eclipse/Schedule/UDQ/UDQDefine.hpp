@@ -23,12 +23,14 @@
 #include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQToken.hpp>
 
 #include <opm/common/OpmLog/KeywordLocation.hpp>
 
 #include <cstddef>
+#include <exception>
 #include <memory>
 #include <optional>
 #include <set>
@@ -78,6 +80,17 @@ public:
     static UDQDefine serializationTestObject();
 
     UDQSet eval(const UDQContext& context) const;
+
+    /// Like eval(), but errors are thrown without being logged.  Does not
+    /// touch the logger, and may therefore be called concurrently for
+    /// different statements.  Pass the exception to report_error() to
+    /// obtain the behaviour of eval().
+    UDQSet eval_unreported(const UDQContext& context) const;
+
+    /// Log an evaluation error of this statement and rethrow it, nested,
+    /// as eval() does.
+    [[noreturn]] void report_error(const std::exception& exc) const;
+
     const std::string& keyword() const;
     const std::string& input_string() const;
     const KeywordLocation& location() const;
@@ -101,6 +114,10 @@ public:
         serializer(string_data);
         serializer(m_update_status);
         serializer(m_report_step);
+
+        if (!serializer.isSerializing()) {
+            this->compile();
+        }
     }
 
 private:
@@ -113,6 +130,12 @@ private:
     UDQUpdate m_update_status{UDQUpdate::NEXT};
     mutable std::optional<std::string> string_data;
 
+    // Compiled form of the expression, if it is supported.  Derived from
+    // the expression tree and therefore not serialized or compared.
+    std::optional<UDQProgram> program{};
+
+    void compile();
+
     UDQSet scatter_scalar_value(UDQSet&& res, const UDQContext& context) const;
     UDQSet scatter_scalar_well_value(const UDQContext& context, const std::optional<double>& value) const;
     UDQSet scatter_scalar_group_value(const UDQContext& context, const std::optional<double>& value) const;
@@ -0,0 +1,366 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Values of one intermediate result.  Scalar results have a single
+// element, well and group results one element per well/group of the
+// UDQContext.
+struct Array
+{
+    Opm::UDQVarType type{Opm::UDQVarType::NONE};
+    std::vector<double> values{};
+    std::vector<std::uint8_t> defined{};
+
+    Array(const Opm::UDQVarType type_arg, const std::size_t size)
+        : type   (type_arg)
+        , values (size, 0.0)
+        , defined(size, 0)
+    {}
+
+    std::size_t size() const
+    {
+        return this->values.size();
+    }
+
+    // Same rule as UDQScalar::assign(): non-finite values are undefined.
+    void assign(const std::size_t index, const double value)
+    {
+        this->values[index] = value;
+        this->defined[index] = std::isfinite(value);
+    }
+
+    void assign(const std::size_t index, const std::optional<double>& value)
+    {
+        if (value.has_value()) {
+            this->assign(index, *value);
+        }
+        else {
+            this->defined[index] = 0;
+        }
+    }
+};
+
+bool is_scalar(const Opm::UDQVarType type)
+{
+    return (type == Opm::UDQVarType::SCALAR)
+        || (type == Opm::UDQVarType::FIELD_VAR);
+}
+
+bool is_set(const Opm::UDQVarType type)
+{
+    return (type == Opm::UDQVarType::WELL_VAR)
+        || (type == Opm::UDQVarType::GROUP_VAR);
+}
+
+// Scalar operand distributed over the elements of a well or group result,
+// as in the promotion of UDQSet operands.  Undefined scalars cannot be
+// promoted.
+std::optional<Array> promote(const Array& scalar, const Array& target)
+{
+    if (! scalar.defined[0]) {
+        return std::nullopt;
+    }
+
+    auto result = Array { target.type, target.size() };
+    std::fill(result.values.begin(), result.values.end(), scalar.values[0]);
+    std::fill(result.defined.begin(), result.defined.end(), std::uint8_t{1});
+    return result;
+}
+
+template <typename Op>
+void apply(Array& lhs, const Array& rhs, Op&& op)
+{
+    for (std::size_t index = 0; index < lhs.size(); ++index) {
+        if (lhs.defined[index] && rhs.defined[index]) {
+            lhs.assign(index, op(lhs.values[index], rhs.values[index]));
+        }
+        else {
+            lhs.defined[index] = 0;
+        }
+    }
+}
+
+// Element by element combination following the rules of the UDQSet
+// operators.  Returns nullopt where those would throw.
+template <typename Op>
+std::optional<Array> combine(Array&& lhs, const Array& rhs, Op&& op)
+{
+    if ((lhs.type == rhs.type) || (is_scalar(lhs.type) && is_scalar(rhs.type))) {
+        if (lhs.size() != rhs.size()) {
+            return std::nullopt;
+        }
+
+        apply(lhs, rhs, op);
+        return std::move(lhs);
+    }
+
+    if (is_scalar(lhs.type) && is_set(rhs.type)) {
+        auto result = promote(lhs, rhs);
+        if (result.has_value()) {
+            apply(*result, rhs, op);
+        }
+
+        return result;
+    }
+
+    if (is_scalar(rhs.type) && is_set(lhs.type)) {
+        const auto promoted = promote(rhs, lhs);
+        if (! promoted.has_value()) {
+            return std::nullopt;
+        }
+
+        apply(lhs, *promoted, op);
+        return std::move(lhs);
+    }
+
+    return std::nullopt;
+}
+
+Array number(const Opm::UDQVarType target_type,
+             const double value,
+             const Opm::UDQContext& context)
+{
+    auto size = std::size_t{1};
+    if (target_type == Opm::UDQVarType::WELL_VAR) {
+        size = context.wells().size();
+    }
+    else if (target_type == Opm::UDQVarType::GROUP_VAR) {
+        size = context.groups().size();
+    }
+
+    auto result = Array { target_type, size };
+    for (std::size_t index = 0; index < size; ++index) {
+        result.assign(index, value);
+    }
+
+    return result;
+}
+
+// The matching wells come in the order of the full well list, so one
+// forward walk finds them all.  Any other order is left to the expression
+// tree, which assigns such wells by name.
+std::optional<Array> well_pattern(const Opm::UDQProgram::Instruction& instruction,
+                                  const Opm::UDQContext& context)
+{
+    const auto& all_wells = context.wells();
+    auto result = Array { Opm::UDQVarType::WELL_VAR, all_wells.size() };
+
+    auto index = std::size_t{0};
+    for (const auto& well : context.wells(instruction.name)) {
+        while ((index < all_wells.size()) && (all_wells[index] != well)) {
+            ++index;
+        }
+
+        if (index == all_wells.size()) {
+            return std::nullopt;
+        }
+
+        result.assign(index++, context.get_well_var(well, instruction.key));
+    }
+
+    return result;
+}
+
+Opm::UDQSet make_set(const std::string& name,
+                     const Array& result,
+                     const Opm::UDQContext& context)
+{
+    auto set = [&result, &name, &context]()
+    {
+        switch (result.type) {
+        case Opm::UDQVarType::WELL_VAR:
+            return Opm::UDQSet::wells(name, context.wells());
+
+        case Opm::UDQVarType::GROUP_VAR:
+            return Opm::UDQSet::groups(name, context.groups());
+
+        default:
+            return Opm::UDQSet { name, result.type };
+        }
+    }();
+
+    for (std::size_t index = 0; index < result.size(); ++index) {
+        if (result.defined[index]) {
+            set.assign(index, result.values[index]);
+        }
+    }
+
+    return set;
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+std::optional<UDQProgram>
+UDQProgram::compile(const UDQASTNode& ast, const UDQVarType target_type)
+{
+    if ((target_type != UDQVarType::WELL_VAR) &&
+        (target_type != UDQVarType::GROUP_VAR) &&
+        ! is_scalar(target_type))
+    {
+        return std::nullopt;
+    }
+
+    auto program = UDQProgram{};
+    program.target_type = target_type;
+    if (! ast.compile(program)) {
+        return std::nullopt;
+    }
+
+    return program;
+}
+
+void UDQProgram::append(Instruction instruction)
+{
+    this->code.push_back(std::move(instruction));
+}
+
+std::optional<UDQSet>
+UDQProgram::eval(const std::string& name, const UDQContext& context) const
+{
+    std::vector<Array> stack;
+
+    for (const auto& instruction : this->code) {
+        switch (instruction.op) {
+        case OpCode::Number:
+            stack.push_back(number(this->target_type, instruction.value, context));
+            break;
+
+        case OpCode::WellVar: {
+            const auto& wells = context.wells();
+            auto& result = stack.emplace_back(UDQVarType::WELL_VAR, wells.size());
+            for (std::size_t index = 0; index < wells.size(); ++index) {
+                result.assign(index, context.get_well_var(wells[index], instruction.key));
+            }
+            break;
+        }
+
+        case OpCode::WellVarPattern: {
+            auto result = well_pattern(instruction, context);
+            if (! result.has_value()) {
+                return std::nullopt;
+            }
+
+            stack.push_back(*std::move(result));
+            break;
+        }
+
+        case OpCode::WellVarSingle:
+            stack.emplace_back(UDQVarType::SCALAR, 1)
+                .assign(0, context.get_well_var(instruction.name, instruction.key));
+            break;
+
+        case OpCode::GroupVar: {
+            const auto& groups = context.groups();
+            auto& result = stack.emplace_back(UDQVarType::GROUP_VAR, groups.size());
+            for (std::size_t index = 0; index < groups.size(); ++index) {
+                result.assign(index, context.get_group_var(groups[index], instruction.key));
+            }
+            break;
+        }
+
+        case OpCode::GroupVarSingle:
+            stack.emplace_back(UDQVarType::SCALAR, 1)
+                .assign(0, context.get_group_var(instruction.name, instruction.key));
+            break;
+
+        case OpCode::FieldVar:
+            stack.emplace_back(UDQVarType::SCALAR, 1)
+                .assign(0, context.get(instruction.key));
+            break;
+
+        case OpCode::Scalar: {
+            const auto value = context.get(instruction.key);
+            if (! value.has_value()) {
+                return std::nullopt;
+            }
+
+            stack.emplace_back(UDQVarType::SCALAR, 1).assign(0, *value);
+            break;
+        }
+
+        case OpCode::Scale: {
+            auto& top = stack.back();
+            for (std::size_t index = 0; index < top.size(); ++index) {
+                if (top.defined[index]) {
+                    top.assign(index, top.values[index] * instruction.value);
+                }
+            }
+            break;
+        }
+
+        case OpCode::Add:
+        case OpCode::Sub:
+        case OpCode::Mul:
+        case OpCode::Div: {
+            auto rhs = std::move(stack.back());
+            stack.pop_back();
+            auto lhs = std::move(stack.back());
+            stack.pop_back();
+
+            auto result = std::optional<Array>{};
+            switch (instruction.op) {
+            case OpCode::Add:
+                result = combine(std::move(lhs), rhs, [](double a, double b) { return a + b; });
+                break;
+            case OpCode::Sub:
+                result = combine(std::move(lhs), rhs, [](double a, double b) { return a - b; });
+                break;
+            case OpCode::Mul:
+                result = combine(std::move(lhs), rhs, [](double a, double b) { return a * b; });
+                break;
+            default:
+                result = combine(std::move(lhs), rhs, [](double a, double b) { return a / b; });
+                break;
+            }
+
+            if (! result.has_value()) {
+                return std::nullopt;
+            }
+
+            stack.push_back(*std::move(result));
+            break;
+        }
+        }
+    }
+
+    if (stack.size() != 1) {
+        return std::nullopt;
+    }
+
+    return make_set(name, stack.front(), context);
+}
+
+} // namespace Opm
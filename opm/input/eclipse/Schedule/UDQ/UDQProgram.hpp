@@ -0,0 +1,93 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQ_PROGRAM_HPP
+#define UDQ_PROGRAM_HPP
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class UDQASTNode;
+class UDQContext;
+
+/// Compiled form of a UDQ DEFINE expression.
+///
+/// The expression tree is lowered to a postfix instruction sequence which
+/// is evaluated over dense arrays of values - one element per well or
+/// group in the order of the UDQContext - with a separate defined mask.
+/// No UDQScalar objects or well names are created for the intermediate
+/// results; only the final result is converted to a UDQSet.
+///
+/// Only summary vectors, numbers, the four arithmetic operators and
+/// unary sign changes are compiled.  Expressions using functions,
+/// segment, region or table lookup values are evaluated through the
+/// expression tree.  The results are the same as those of
+/// UDQASTNode::eval(), element by element.
+class UDQProgram
+{
+public:
+    enum class OpCode
+    {
+        Number,         ///< Constant, shaped by the target type.
+        WellVar,        ///< Summary vector of all wells.
+        WellVarPattern, ///< Summary vector of the wells matching 'name'.
+        WellVarSingle,  ///< Summary vector of well 'name', as a scalar.
+        GroupVar,       ///< Summary vector of all groups.
+        GroupVarSingle, ///< Summary vector of group 'name', as a scalar.
+        FieldVar,       ///< Field level value, may be undefined.
+        Scalar,         ///< Other scalar value, must be defined.
+        Add, Sub, Mul, Div,
+        Scale,          ///< Multiply by 'value'.
+    };
+
+    struct Instruction
+    {
+        OpCode op{OpCode::Number};
+        double value{0.0};
+        std::string key{};
+        std::string name{};
+    };
+
+    /// Compile \p ast for evaluation into a set of type \p target_type.
+    /// Returns nullopt if the expression is not supported.
+    static std::optional<UDQProgram>
+    compile(const UDQASTNode& ast, UDQVarType target_type);
+
+    void append(Instruction instruction);
+
+    /// Evaluate the program.  Returns nullopt in the cases where the
+    /// expression tree evaluation throws, e.g. when combining well and
+    /// group values, such that the caller can evaluate the tree to report
+    /// the error.
+    std::optional<UDQSet> eval(const std::string& name, const UDQContext& context) const;
+
+private:
+    UDQVarType target_type{UDQVarType::NONE};
+    std::vector<Instruction> code{};
+};
+
+} // namespace Opm
+
+#endif // UDQ_PROGRAM_HPP
@@ -320,8 +320,9 @@ std::size_t UDQSet::size() const
 void UDQSet::assign(const std::string& wgname, const double value)
 {
     bool assigned = false;
+    const auto pattern = ShellPattern { wgname };
     for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
+        if (pattern.match(udq_value.wgname())) {
             udq_value.assign(value);
             assigned = true;
         }
@@ -343,8 +344,9 @@ void UDQSet::assign(const std::string&           wgname,
                     const std::optional<double>& value)
 {
     bool assigned = false;
+    const auto pattern = ShellPattern { wgname };
     for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
+        if (pattern.match(udq_value.wgname())) {
             udq_value.assign(value);
             assigned = true;
         }
@@ -362,9 +364,10 @@ void UDQSet::assign(const std::string&           wgname,
                     const std::optional<double>& value)
 {
     auto assigned = false;
+    const auto pattern = ShellPattern { wgname };
 
     for (auto& udq : this->values) {
-        if ((udq.number() == number) && shmatch(wgname, udq.wgname())) {
+        if ((udq.number() == number) && pattern.match(udq.wgname())) {
             udq.assign(value);
             assigned = true;
         }
@@ -430,8 +433,13 @@ void UDQSet::operator-=(double rhs) {
     *(this) += (-rhs);
 }
 
-void UDQSet::operator-=(const UDQSet& rhs) {
-    *(this) += (rhs * -1.0);
+void UDQSet::operator-=(const UDQSet& rhs)
+{
+    if (this->size() != rhs.size())
+        throw std::logic_error("Incompatible size in UDQSet operator-");
+
+    for (std::size_t index = 0; index < this->size(); index++)
+        this->values[index] -= rhs[index];
 }
 
 void UDQSet::operator*=(const UDQSet& rhs)
@@ -647,54 +655,69 @@ bool is_scalar(const UDQSet& udq_set)
         || (vtype == UDQVarType::FIELD_VAR);
 }
 
-// If one result set is scalar and the other represents a set of
-// wells/groups, the scalar result is promoted to a set of the right type.
+[[noreturn]] void throw_type_mismatch(const UDQSet& lhs, const UDQSet& rhs)
+{
+    throw std::logic_error {
+        fmt::format("Type/size mismatch when combining UDQs "
+                    "{}(size={}, type={}) and "
+                    "{}(size={}, type={})",
+                    lhs.name(), lhs.size(), UDQ::typeName(lhs.var_type()),
+                    rhs.name(), rhs.size(), UDQ::typeName(rhs.var_type()))
+    };
+}
+
+// Promote a scalar result set to a set of wells/groups matching 'target'.
+UDQSet promote(const UDQSet& scalar, const UDQSet& target,
+               const UDQSet& lhs, const UDQSet& rhs)
+{
+    if (target.var_type() == UDQVarType::WELL_VAR) {
+        return UDQSet::wells(scalar.name(), target.wgnames(), scalar[0].get());
+    }
+
+    if (target.var_type() == UDQVarType::GROUP_VAR) {
+        return UDQSet::groups(scalar.name(), target.wgnames(), scalar[0].get());
+    }
+
+    throw_type_mismatch(lhs, rhs);
+}
+
+// Combine two result sets element by element.  If one result set is scalar
+// and the other represents a set of wells/groups, the scalar result is
+// promoted to a set of the right type.  Only the left operand is copied,
+// or the scalar one if it is promoted.
 //
 // This function is quite subconscious about FIELD / SCALAR.
-std::pair<UDQSet, UDQSet> udq_cast(const UDQSet& lhs, const UDQSet& rhs)
+template <typename Op>
+UDQSet udq_combine(const UDQSet& lhs, const UDQSet& rhs, Op&& op)
 {
     if ((lhs.var_type() == rhs.var_type()) ||
         (is_scalar(lhs) && is_scalar(rhs)))
     {
-        return { lhs, rhs };
+        auto result = lhs;
+        op(result, rhs);
+        return result;
     }
 
     if (is_scalar(lhs)) {
-        if (rhs.var_type() == UDQVarType::WELL_VAR) {
-            return { UDQSet::wells(lhs.name(), rhs.wgnames(), lhs[0].get()), rhs };
-        }
-
-        if (rhs.var_type() == UDQVarType::GROUP_VAR) {
-            return { UDQSet::groups(lhs.name(), rhs.wgnames(), lhs[0].get()), rhs };
-        }
+        auto result = promote(lhs, rhs, lhs, rhs);
+        op(result, rhs);
+        return result;
     }
 
     if (is_scalar(rhs)) {
-        if (lhs.var_type() == UDQVarType::WELL_VAR) {
-            return { lhs, UDQSet::wells(rhs.name(), lhs.wgnames(), rhs[0].get()) };
-        }
-
-        if (lhs.var_type() == UDQVarType::GROUP_VAR) {
-            return { lhs, UDQSet::groups(rhs.name(), lhs.wgnames(), rhs[0].get()) };
-        }
+        auto result = lhs;
+        op(result, promote(rhs, lhs, lhs, rhs));
+        return result;
     }
 
-    throw std::logic_error {
-        fmt::format("Type/size mismatch when combining UDQs "
-                    "{}(size={}, type={}) and "
-                    "{}(size={}, type={})",
-                    lhs.name(), lhs.size(), UDQ::typeName(lhs.var_type()),
-                    rhs.name(), rhs.size(), UDQ::typeName(rhs.var_type()))
-    };
+    throw_type_mismatch(lhs, rhs);
 }
 
 } // Anonymous namespace
 
 UDQSet operator+(const UDQSet& lhs, const UDQSet& rhs)
 {
-    auto [left,right] = udq_cast(lhs, rhs);
-    left += right;
-    return left;
+    return udq_combine(lhs, rhs, [](UDQSet& left, const UDQSet& right) { left += right; });
 }
 
 UDQSet operator+(const UDQSet& lhs, double rhs)
@@ -713,9 +736,7 @@ UDQSet operator+(double lhs, const UDQSet& rhs)
 
 UDQSet operator-(const UDQSet& lhs, const UDQSet& rhs)
 {
-    auto [left,right] = udq_cast(lhs, rhs);
-    left -= right;
-    return left;
+    return udq_combine(lhs, rhs, [](UDQSet& left, const UDQSet& right) { left -= right; });
 }
 
 UDQSet operator-(const UDQSet& lhs, double rhs)
@@ -734,9 +755,7 @@ UDQSet operator-(double lhs, const UDQSet& rhs)
 
 UDQSet operator*(const UDQSet& lhs, const UDQSet& rhs)
 {
-    auto [left,right] = udq_cast(lhs, rhs);
-    left *= right;
-    return left;
+    return udq_combine(lhs, rhs, [](UDQSet& left, const UDQSet& right) { left *= right; });
 }
 
 UDQSet operator*(const UDQSet& lhs, double rhs)
@@ -755,9 +774,7 @@ UDQSet operator*(double lhs, const UDQSet& rhs)
 
 UDQSet operator/(const UDQSet& lhs, const UDQSet& rhs)
 {
-    auto [left, right] = udq_cast(lhs, rhs);
-    left /= right;
-    return left;
+    return udq_combine(lhs, rhs, [](UDQSet& left, const UDQSet& right) { left /= right; });
 }
 
 UDQSet operator/(const UDQSet& lhs, double rhs)
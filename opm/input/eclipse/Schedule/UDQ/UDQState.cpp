@@ -204,6 +204,8 @@ namespace Opm {
 
 void UDQState::load_rst(const RestartIO::RstState& rst_state)
 {
+    this->reset_change_stamps();
+
     for (const auto& udq : rst_state.udqs) {
         // Note: Cases listed in order of increasing enumerator values from
         // the UDQEnums.hpp header file (Opm::UDQVarType).
@@ -308,6 +310,8 @@ void UDQState::add(const std::string& udq_key, const UDQSet& result)
         }
         break;
     }
+
+    this->change_stamps.touch(udq_key);
 }
 
 void UDQState::add_define(std::size_t report_step, const std::string& udq_key, const UDQSet& result)
@@ -463,6 +467,33 @@ UDQState UDQState::serializationTestObject()
     return st;
 }
 
+std::size_t UDQState::change_stamp(const std::string& udq_key) const
+{
+    return this->change_stamps.get(udq_key);
+}
+
+void UDQState::record_define_inputs(const std::string& udq_key,
+                                    const std::size_t  report_step,
+                                    const std::size_t  input_stamp)
+{
+    this->define_inputs.insert_or_assign(udq_key, std::pair { report_step, input_stamp });
+}
+
+bool UDQState::define_inputs_unchanged(const std::string& udq_key,
+                                       const std::size_t  report_step,
+                                       const std::size_t  input_stamp) const
+{
+    auto pos = this->define_inputs.find(udq_key);
+    return (pos != this->define_inputs.end())
+        && (pos->second == std::pair { report_step, input_stamp });
+}
+
+void UDQState::reset_change_stamps()
+{
+    this->change_stamps.touch_all();
+    this->define_inputs.clear();
+}
+
 bool UDQState::define(const std::string&                       udq_key,
                       const std::pair<UDQUpdate, std::size_t>& update_status) const
 {
@@ -20,6 +20,7 @@
 #ifndef UDQSTATE_HPP_
 #define UDQSTATE_HPP_
 
+#include <opm/input/eclipse/Schedule/ChangeStamps.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 
 #include <opm/output/eclipse/WindowedArray.hpp>
@@ -65,6 +66,16 @@ public:
     bool define(const std::string& udq_key, const std::pair<UDQUpdate, std::size_t>& update_status) const;
     double undefined_value() const;
 
+    // Stamp of the last assignment to the UDQ 'udq_key'.  See ChangeStamps.
+    std::size_t change_stamp(const std::string& udq_key) const;
+
+    // Bookkeeping for skipping DEFINE statements whose inputs are
+    // unchanged.  'input_stamp' is the newest change stamp of all values
+    // read by the statement, including the UDQ itself, after its result
+    // has been assigned.
+    void record_define_inputs(const std::string& udq_key, std::size_t report_step, std::size_t input_stamp);
+    bool define_inputs_unchanged(const std::string& udq_key, std::size_t report_step, std::size_t input_stamp) const;
+
     bool operator==(const UDQState& other) const;
 
     static UDQState serializationTestObject();
@@ -78,6 +89,10 @@ public:
         serializer(this->group_values);
         serializer(this->segment_values);
         serializer(this->defines);
+
+        if (!serializer.isSerializing()) {
+            this->reset_change_stamps();
+        }
     }
 
 private:
@@ -95,6 +110,11 @@ private:
 
     std::unordered_map<std::string, std::size_t> defines{};
 
+    // Not serialized or compared.
+    ChangeStamps change_stamps{};
+    std::unordered_map<std::string, std::pair<std::size_t, std::size_t>> define_inputs{};
+
+    void reset_change_stamps();
     void add(const std::string& udq_key, const UDQSet& result);
     double get_wg_var(const std::string& well, const std::string& key, UDQVarType var_type) const;
 };
@@ -19,9 +19,13 @@
 
 #include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
 
+#include <opm/common/utility/shmatch.hpp>
+
 #include <algorithm>
 #include <cstddef>
 #include <initializer_list>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -35,8 +39,10 @@ void NameOrder::add(const std::string& name)
         .emplace(name, this->m_name_list.size());
 
     if (emplaceResult.second) {
-        // New element inserted.  Update name list.
+        // New element inserted.  Update name list and drop cached
+        // pattern matches, possibly shared with other objects.
         this->m_name_list.push_back(name);
+        this->m_pattern_cache = std::make_shared<PatternCache>();
     }
 }
 
@@ -59,6 +65,35 @@ bool NameOrder::has(const std::string& wname) const
     return this->m_index_map.find(wname) != this->m_index_map.end();
 }
 
+std::vector<std::size_t> NameOrder::match(const std::string& pattern) const
+{
+    // The cache is null in a moved-from object only.
+    auto* cache = this->m_pattern_cache.get();
+    if (cache != nullptr) {
+        std::lock_guard<std::mutex> lock { cache->mutex };
+        auto pos = cache->matches.find(pattern);
+        if (pos != cache->matches.end()) {
+            return pos->second;
+        }
+    }
+
+    const auto compiled = ShellPattern { pattern };
+
+    std::vector<std::size_t> indices;
+    for (std::size_t i = 0; i < this->m_name_list.size(); ++i) {
+        if (compiled.match(this->m_name_list[i])) {
+            indices.push_back(i);
+        }
+    }
+
+    if (cache != nullptr) {
+        std::lock_guard<std::mutex> lock { cache->mutex };
+        cache->matches.emplace(pattern, indices);
+    }
+
+    return indices;
+}
+
 const std::vector<std::string>& NameOrder::names() const
 {
     return this->m_name_list;
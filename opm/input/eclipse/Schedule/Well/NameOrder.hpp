@@ -21,6 +21,8 @@
 
 #include <cstddef>
 #include <initializer_list>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -43,11 +45,26 @@ public:
     const std::vector<std::string>& names() const;
     bool has(const std::string& wname) const;
 
+    /// Insertion indices of the names matching a shell pattern.
+    ///
+    /// The result is cached per pattern.  The cache is shared between
+    /// copies of the object, which is valid for as long as neither of them
+    /// changes, and is discarded when a new name is added.
+    ///
+    /// \param[in] pattern Shell pattern, e.g., 'P*'.
+    ///
+    /// \return Indices of the matching names in increasing order.
+    std::vector<std::size_t> match(const std::string& pattern) const;
+
     template <class Serializer>
     void serializeOp(Serializer& serializer)
     {
         serializer(m_index_map);
         serializer(m_name_list);
+
+        if (!serializer.isSerializing()) {
+            this->m_pattern_cache = std::make_shared<PatternCache>();
+        }
     }
 
     static NameOrder serializationTestObject();
@@ -60,8 +77,15 @@ public:
     auto size()  const { return this->m_name_list.size(); }
 
 private:
+    struct PatternCache
+    {
+        std::mutex mutex{};
+        std::unordered_map<std::string, std::vector<std::size_t>> matches{};
+    };
+
     std::unordered_map<std::string, std::size_t> m_index_map;
     std::vector<std::string> m_name_list;
+    std::shared_ptr<PatternCache> m_pattern_cache = std::make_shared<PatternCache>();
 };
 
 class GroupOrder
@@ -24,6 +24,7 @@
 #include <opm/io/eclipse/rst/state.hpp>
 
 #include <algorithm>
+#include <unordered_set>
 
 namespace Opm {
 
@@ -180,14 +181,13 @@ namespace Opm {
             return { wlist.wells() };
         } else {
             std::vector<std::string> well_set;
-            auto pattern = wlist_pattern.substr(1);
+            std::unordered_set<std::string> seen;
+            const auto pattern = ShellPattern { wlist_pattern.substr(1) };
             for (const auto& [name, wlist] : this->wlists) {
-                auto wlist_name = name.substr(1);
-                if (shmatch(pattern, wlist_name)) {
-                    const auto& well_names = wlist.wells();
-                    for ( auto it = well_names.begin(); it != well_names.end(); it++ ) {
-                       if (std::count(well_set.begin(), well_set.end(), *it) == 0)
-                           well_set.push_back(*it);
+                if (pattern.match(name.substr(1))) {
+                    for (const auto& wname : wlist.wells()) {
+                        if (seen.insert(wname).second)
+                            well_set.push_back(wname);
                     }
                 }
             }
@@ -30,6 +30,7 @@
 #include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/GridDims.hpp>
 
+#include <opm/input/eclipse/Schedule/CompletedCells.hpp>
 #include <opm/input/eclipse/Schedule/ScheduleGrid.hpp>
 #include <opm/input/eclipse/Schedule/Well/Connection.hpp>
 #include <opm/input/eclipse/Schedule/Well/WDFAC.hpp>
@@ -51,6 +52,8 @@
 #include <cmath>
 #include <cstddef>
 #include <limits>
+#include <map>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -226,6 +229,221 @@ namespace {
         return connection_factor;
     }
 
+    // Angle of completion exposed to flow.  We assume centre placement so
+    // there's complete exposure (= 2\pi).
+    constexpr double completionAngle = 6.2831853071795864769252867665590057683943387987502116419498;
+
+    // Connection factors are evaluated in parallel only for records which
+    // complete enough cells to amortise the thread start-up cost.
+    constexpr std::size_t minParallelConnections = 64;
+
+    // Items of a COMPDAT record which are common to all of its cells.
+    struct CompdatCTFInput
+    {
+        Opm::Connection::Direction direction{};
+        double rw{};
+        double skin_factor{};
+        double d_factor{};
+        double r0{-1.0};
+        double Kh{-1.0};
+        double CF{-1.0};
+
+        // Kh explicitly defaulted, rather than entered as zero.
+        bool Kh_defaulted{false};
+    };
+
+    // Connection transmissibility factor, Kh and equivalent radius of a
+    // COMPDAT connection in an active cell.
+    Opm::Connection::CTFProperties
+    compdatCTFProperties(const CompdatCTFInput&           input,
+                         const Opm::CompletedCells::Cell& cell,
+                         const Opm::WDFAC&                wdfac)
+    {
+        const auto& props = cell.props;
+
+        auto ctf_props = Opm::Connection::CTFProperties{};
+        ctf_props.rw = input.rw;
+        ctf_props.skin_factor = input.skin_factor;
+        ctf_props.d_factor = input.d_factor;
+        ctf_props.r0 = input.r0;
+        ctf_props.Kh = input.Kh;
+        ctf_props.CF = input.CF;
+
+        const auto D = effectiveExtent(input.direction, props->ntg, cell.dimensions);
+        const auto K = permComponents(input.direction, { props->permx, props->permy, props->permz });
+        ctf_props.Ke = std::sqrt(K[0] * K[1]);
+
+        if ((ctf_props.CF > 0.0) && (ctf_props.Kh > 0.0)) {
+            // We start with the absolute happy path; both CF and Kh are
+            // explicitly given in the deck.
+            ctf_props.peaceman_denom = completionAngle * ctf_props.Kh / ctf_props.CF;
+        }
+        else {
+            // We must calculate CF and Kh from the items in the COMPDAT
+            // record and cell properties.
+            if (ctf_props.r0 < 0.0) {
+                ctf_props.r0 = effectiveRadius(K, D);
+            }
+
+            if (const auto peaceman_denom = peacemanDenominator(ctf_props);
+                ctf_props.Kh > 0.0)
+            {
+                // CF < 0
+                ctf_props.CF = completionAngle * ctf_props.Kh / peaceman_denom;
+                ctf_props.peaceman_denom = peaceman_denom;
+            }
+            else if (ctf_props.CF > 0.0) { // Kh < 0
+                if (input.Kh_defaulted) {
+                    // Kh explicitly defaulted.  Derive compatible Kh value
+                    // from specified CTF, r0, rw, and skin factor.
+                    ctf_props.Kh = ctf_props.CF * peaceman_denom / completionAngle;
+                }
+                else {
+                    // Kh = 0 entered in item 10 of COMPDAT.  Compute Kh
+                    // from permeability and length of perforation interval
+                    // and request a compatible pressure equivalent radius
+                    // (r0) be calculated.
+                    ctf_props.Kh = ctf_props.Ke * D[2];
+
+                    // Defer r0 calculation to r0 < 0 case below.
+                    ctf_props.r0 = -1.0;
+                }
+
+                ctf_props.peaceman_denom = completionAngle * ctf_props.Kh / ctf_props.CF;
+            }
+            else {              // (CF < 0) && (Kh < 0)
+                ctf_props.Kh = ctf_props.Ke * D[2];
+                ctf_props.CF = completionAngle * ctf_props.Kh / peaceman_denom;
+                ctf_props.peaceman_denom = peaceman_denom;
+            }
+        }
+
+        if (ctf_props.r0 < 0.0) {
+            ctf_props.r0 = Opm::RestartIO::RstConnection::
+                inverse_peaceman(ctf_props.CF, ctf_props.Kh,
+                                 ctf_props.rw,
+                                 ctf_props.skin_factor);
+        }
+
+        // Length of the well perforation interval.
+        ctf_props.connection_length = ctf_props.Kh / ctf_props.Ke;
+
+        // Area equivalent radius of the grid block.  Used by the
+        // PolymerMW module.
+        ctf_props.re = std::sqrt(D[0] * D[1] / completionAngle * 2);
+
+        ctf_props.static_dfac_corr_coeff =
+            staticForchheimerCoefficient(ctf_props, props->poro, wdfac);
+
+        return ctf_props;
+    }
+
+    // Connection transmissibility factor and Kh of a COMPTRAJ connection
+    // in an active cell.  CF and Kh are either both given or both
+    // defaulted.
+    Opm::Connection::CTFProperties
+    comptrajCTFProperties(const Opm::Connection::CTFProperties& record_props,
+                          const Opm::CompletedCells::Cell&      cell,
+                          const external::cvf::Vec3d&           connection_vector)
+    {
+        const auto& props = cell.props;
+        auto ctf_props = record_props;
+
+        const auto cell_perm = std::array {
+            props->permx, props->permy, props->permz
+        };
+
+        if ((ctf_props.CF < 0.0) && (ctf_props.Kh < 0.0)) {
+            // We must calculate CF and Kh from the items in the COMPTRAJ
+            // record and cell properties.
+            const auto perm_thickness =
+                permThickness(connection_vector, cell_perm, props->ntg);
+
+            const auto connection_factor =
+                connectionFactor(cell_perm, cell.dimensions, props->ntg,
+                                 perm_thickness, ctf_props.rw, ctf_props.skin_factor);
+
+            ctf_props.connection_length = connection_vector.length();
+
+            ctf_props.CF = std::hypot(connection_factor[0],
+                                      connection_factor[1],
+                                      connection_factor[2]);
+
+            ctf_props.Kh = std::hypot(perm_thickness[0],
+                                      perm_thickness[1],
+                                      perm_thickness[2]);
+        }
+
+        // Todo: check what needs to be done for polymerMW module, see
+        // loadCOMPDAT used by the PolymerMW module
+
+        ctf_props.re = -1;
+
+        const auto K = permComponents(Opm::Connection::Direction::Z, cell_perm);
+        ctf_props.Ke = std::sqrt(K[0] * K[1]);
+
+        return ctf_props;
+    }
+
+    // Position of the first connection in each cell.  Records completing
+    // many cells look up existing connections here rather than searching
+    // the whole connection list once per cell.
+    class ConnectionPositions
+    {
+    public:
+        ConnectionPositions(const std::vector<Opm::Connection>& connections,
+                            const std::size_t                   num_lookups)
+            : connections_ { connections }
+            , indexed_     { num_lookups > 1 }
+        {
+            if (! this->indexed_) {
+                return;
+            }
+
+            for (std::size_t c = 0; c < connections.size(); ++c) {
+                this->add(c);
+            }
+        }
+
+        std::optional<std::size_t> find(const int i, const int j, const int k) const
+        {
+            if (this->indexed_) {
+                auto pos = this->positions_.find({ i, j, k });
+                if (pos == this->positions_.end()) {
+                    return {};
+                }
+
+                return pos->second;
+            }
+
+            auto conn = std::find_if(this->connections_.begin(),
+                                     this->connections_.end(),
+                                     [i, j, k](const Opm::Connection& c)
+                                     { return c.sameCoordinate(i, j, k); });
+
+            if (conn == this->connections_.end()) {
+                return {};
+            }
+
+            return static_cast<std::size_t>(std::distance(this->connections_.begin(), conn));
+        }
+
+        // Record connection number c, typically after it has been
+        // appended to the connection list.
+        void add(const std::size_t c)
+        {
+            if (this->indexed_) {
+                const auto& conn = this->connections_[c];
+                this->positions_.try_emplace({ conn.getI(), conn.getJ(), conn.getK() }, c);
+            }
+        }
+
+    private:
+        const std::vector<Opm::Connection>& connections_;
+        bool indexed_{false};
+        std::map<std::array<int, 3>, std::size_t> positions_{};
+    };
+
 } // anonymous namespace
 
 namespace Opm {
@@ -377,9 +595,6 @@ namespace Opm {
         const auto& satTableIdItem = record.getItem("SAT_TABLE");
         const auto direction = Connection::DirectionFromString(record.getItem("DIR").getTrimmedString(0));
 
-        const auto skin_factor = record.getItem("SKIN").getSIDouble(0);
-        const auto d_factor = record.getItem("D_FACTOR").getSIDouble(0);
-
         int satTableId = -1;
         bool defaultSatTable = true;
         if (satTableIdItem.hasValue(0) && (satTableIdItem.get<int>(0) > 0)) {
@@ -387,21 +602,42 @@ namespace Opm {
             defaultSatTable = false;
         }
 
-        double rw{};
+        auto ctf_input = CompdatCTFInput{};
+        ctf_input.direction = direction;
+        ctf_input.skin_factor = record.getItem("SKIN").getSIDouble(0);
+        ctf_input.d_factor = record.getItem("D_FACTOR").getSIDouble(0);
+
         if (diameterItem.hasValue(0)) {
-            rw = diameterItem.getSIDouble(0) / 2;
+            ctf_input.rw = diameterItem.getSIDouble(0) / 2;
         }
         else {
             // The Eclipse100 manual does not specify a default value for the wellbore
             // diameter, but the Opm codebase has traditionally implemented a default
             // value of one foot. The same default value is used by Eclipse300.
-            rw = 0.5*unit::feet;
+            ctf_input.rw = 0.5*unit::feet;
+        }
+
+        if (r0Item.hasValue(0)) {
+            ctf_input.r0 = r0Item.getSIDouble(0);
         }
 
-        // Angle of completion exposed to flow.  We assume centre
-        // placement so there's complete exposure (= 2\pi).
-        const auto angle = 6.2831853071795864769252867665590057683943387987502116419498;
+        if (KhItem.hasValue(0) && (KhItem.getSIDouble(0) > 0.0)) {
+            ctf_input.Kh = KhItem.getSIDouble(0);
+        }
 
+        if (CFItem.hasValue(0) && (CFItem.getSIDouble(0) > 0.0)) {
+            ctf_input.CF = CFItem.getSIDouble(0);
+        }
+
+        ctf_input.Kh_defaulted = KhItem.defaultApplied(0) || (KhItem.get<double>(0) < 0.0);
+
+        const auto ctf_kind = (ctf_input.CF < 0.0)
+            ? ::Opm::Connection::CTFKind::Defaulted
+            : ::Opm::Connection::CTFKind::DeckValue;
+
+        // Looking up the cells may add them to the CompletedCells
+        // container, so this part is serial.
+        auto cells = std::vector<std::pair<int, const CompletedCells::Cell*>>{};
         for (int k = K1; k <= K2; ++k) {
             const auto& cell = grid.get_cell(I, J, k);
             if (!cell.is_active()) {
@@ -415,118 +651,36 @@ The cell ({},{},{}) in well {} is not active and the connection will be ignored)
                 continue;
             }
 
-            const auto& props = cell.props;
-
-            auto ctf_props = ::Opm::Connection::CTFProperties{};
-            ctf_props.rw = rw;
-            ctf_props.skin_factor = skin_factor;
-            ctf_props.d_factor = d_factor;
-
-            if (defaultSatTable) {
-                satTableId = props->satnum;
-            }
-
-            ctf_props.r0 = -1.0;
-            if (r0Item.hasValue(0)) {
-                ctf_props.r0 = r0Item.getSIDouble(0);
-            }
-
-            ctf_props.Kh = -1.0;
-            if (KhItem.hasValue(0) && (KhItem.getSIDouble(0) > 0.0)) {
-                ctf_props.Kh = KhItem.getSIDouble(0);
-            }
-
-            ctf_props.CF = -1.0;
-            if (CFItem.hasValue(0) && (CFItem.getSIDouble(0) > 0.0)) {
-                ctf_props.CF = CFItem.getSIDouble(0);
-            }
-
-            const auto D = effectiveExtent(direction, props->ntg, cell.dimensions);
-            const auto K = permComponents(direction, { props->permx, props->permy, props->permz });
-            ctf_props.Ke = std::sqrt(K[0] * K[1]);
-
-            const auto ctf_kind = (ctf_props.CF < 0.0)
-                ? ::Opm::Connection::CTFKind::Defaulted
-                : ::Opm::Connection::CTFKind::DeckValue;
-
-            // We start with the absolute happy path; both CF and Kh are
-            // explicitly given in the deck.
-            if ((ctf_props.CF > 0.0) && (ctf_props.Kh > 0.0)) {
-                ctf_props.peaceman_denom = angle * ctf_props.Kh / ctf_props.CF;
-                goto CF_done;
-            }
+            cells.emplace_back(k, &cell);
+        }
 
-            // We must calculate CF and Kh from the items in the COMPDAT
-            // record and cell properties.
-            if (ctf_props.r0 < 0.0) {
-                ctf_props.r0 = effectiveRadius(K, D);
-            }
+        auto ctf_props = std::vector<Connection::CTFProperties>(cells.size());
 
-            if (const auto peaceman_denom = peacemanDenominator(ctf_props);
-                ctf_props.Kh > 0.0)
-            {
-                // CF < 0
-                ctf_props.CF = angle * ctf_props.Kh / peaceman_denom;
-                ctf_props.peaceman_denom = peaceman_denom;
-            }
-            else if (ctf_props.CF > 0.0) { // Kh < 0
-                if (KhItem.defaultApplied(0) || (KhItem.get<double>(0) < 0.0)) {
-                    // Kh explicitly defaulted.  Derive compatible Kh value
-                    // from specified CTF, r0, rw, and skin factor.
-                    ctf_props.Kh = ctf_props.CF * peaceman_denom / angle;
-                }
-                else {
-                    // Kh = 0 entered in item 10 of COMPDAT.  Compute Kh
-                    // from permeability and length of perforation interval
-                    // and request a compatible pressure equivalent radius
-                    // (r0) be calculated.
-                    ctf_props.Kh = ctf_props.Ke * D[2];
-
-                    // Defer r0 calculation to CF_done: r0 < 0 case.
-                    ctf_props.r0 = -1.0;
-                }
+#pragma omp parallel for schedule(static) if (cells.size() >= minParallelConnections)
+        for (std::size_t c = 0; c < cells.size(); ++c) {
+            ctf_props[c] = compdatCTFProperties(ctf_input, *cells[c].second, wdfac);
+        }
 
-                ctf_props.peaceman_denom = angle * ctf_props.Kh / ctf_props.CF;
-            }
-            else {              // (CF < 0) && (Kh < 0)
-                ctf_props.Kh = ctf_props.Ke * D[2];
-                ctf_props.CF = angle * ctf_props.Kh / peaceman_denom;
-                ctf_props.peaceman_denom = peaceman_denom;
-            }
+        auto positions = ConnectionPositions { this->m_connections, cells.size() };
+        for (std::size_t c = 0; c < cells.size(); ++c) {
+            const auto k = cells[c].first;
+            const auto& cell = *cells[c].second;
 
-        CF_done:
-            if (ctf_props.r0 < 0.0) {
-                ctf_props.r0 = RestartIO::RstConnection::
-                    inverse_peaceman(ctf_props.CF, ctf_props.Kh,
-                                     ctf_props.rw,
-                                     ctf_props.skin_factor);
+            if (defaultSatTable) {
+                satTableId = cell.props->satnum;
             }
 
-            // Length of the well perforation interval.
-            ctf_props.connection_length = ctf_props.Kh / ctf_props.Ke;
-
-            // Area equivalent radius of the grid block.  Used by the
-            // PolymerMW module.
-            ctf_props.re = std::sqrt(D[0] * D[1] / angle * 2);
-
-            ctf_props.static_dfac_corr_coeff =
-                staticForchheimerCoefficient(ctf_props, props->poro, wdfac);
-
-            auto prev = std::find_if(this->m_connections.begin(),
-                                     this->m_connections.end(),
-                                     [I, J, k](const Connection& c)
-                                     {
-                                         return c.sameCoordinate(I, J, k);
-                                     });
-
-            if (prev == this->m_connections.end()) {
+            const auto prev_pos = positions.find(I, J, k);
+            if (! prev_pos.has_value()) {
                 const std::size_t noConn = this->m_connections.size();
                 this->addConnection(I, J, k, cell.global_index, state,
-                                    cell.depth, ctf_props, satTableId,
+                                    cell.depth, ctf_props[c], satTableId,
                                     direction, ctf_kind,
                                     noConn, defaultSatTable);
+                positions.add(noConn);
             }
             else {
+                auto prev = this->m_connections.begin() + *prev_pos;
                 const auto compl_num = prev->complnum();
                 const auto css_ind = prev->sort_value();
                 const auto conSegNo = prev->segment();
@@ -535,7 +689,7 @@ The cell ({},{},{}) in well {} is not active and the connection will be ignored)
                 *prev = Connection {
                     I, J, k, cell.global_index, compl_num,
                     state, direction, ctf_kind, satTableId,
-                    cell.depth, ctf_props,
+                    cell.depth, ctf_props[c],
                     css_ind, defaultSatTable
                 };
 
@@ -611,6 +765,9 @@ The cell ({},{},{}) in well {} is not active and the connection will be ignored)
         // exit cell face point and connection length.
         auto intersections = e->cellIntersectionInfosAlongWellPath();
 
+        // Looking up the cells may add them to the CompletedCells
+        // container, so this part is serial.
+        auto cells = std::vector<std::pair<std::size_t, const CompletedCells::Cell*>>{};
         for (size_t is = 0; is < intersections.size(); ++is) {
             const auto ijk = ecl_grid->getIJK(intersections[is].globCellIndex);
 
@@ -641,89 +798,70 @@ The cell ({},{},{}) in well {} is not active and the connection will be ignored)
                 continue;
             }
 
-            const auto& props = cell.props;
-
-            auto ctf_props = Connection::CTFProperties{};
-            ctf_props.rw = rw;
-            ctf_props.skin_factor = skin_factor;
-            ctf_props.d_factor = d_factor;
-
-            ctf_props.r0 = -1.0;
-            ctf_props.Kh = -1.0;
-            if (KhItem.hasValue(0) && (KhItem.getSIDouble(0) > 0.0)) {
-                ctf_props.Kh = KhItem.getSIDouble(0);
-            }
-
-            ctf_props.CF = -1.0;
-            if (CFItem.hasValue(0) && (CFItem.getSIDouble(0) > 0.0)) {
-                ctf_props.CF = CFItem.getSIDouble(0);
-            }
-
-            const auto cell_perm = std::array {
-                props->permx, props->permy, props->permz
-            };
-
-            auto ctf_kind = ::Opm::Connection::CTFKind::DeckValue;
-            if ((ctf_props.CF < 0.0) && (ctf_props.Kh < 0.0)) {
-                // We must calculate CF and Kh from the items in the
-                // COMPTRAJ record and cell properties.
-                ctf_kind = ::Opm::Connection::CTFKind::Defaulted;
-
-                const auto& connection_vector =
-                    intersections[is].intersectionLengthsInCellCS;
+            cells.emplace_back(is, &cell);
+        }
 
-                const auto perm_thickness =
-                    permThickness(connection_vector, cell_perm, props->ntg);
+        if (cells.empty()) {
+            return;
+        }
 
-                const auto connection_factor =
-                    connectionFactor(cell_perm, cell.dimensions, props->ntg,
-                                     perm_thickness, rw, skin_factor);
+        auto record_props = Connection::CTFProperties{};
+        record_props.rw = rw;
+        record_props.skin_factor = skin_factor;
+        record_props.d_factor = d_factor;
 
-                ctf_props.connection_length = connection_vector.length();
+        record_props.r0 = -1.0;
+        record_props.Kh = -1.0;
+        if (KhItem.hasValue(0) && (KhItem.getSIDouble(0) > 0.0)) {
+            record_props.Kh = KhItem.getSIDouble(0);
+        }
 
-                ctf_props.CF = std::hypot(connection_factor[0],
-                                          connection_factor[1],
-                                          connection_factor[2]);
+        record_props.CF = -1.0;
+        if (CFItem.hasValue(0) && (CFItem.getSIDouble(0) > 0.0)) {
+            record_props.CF = CFItem.getSIDouble(0);
+        }
 
-                ctf_props.Kh = std::hypot(perm_thickness[0],
-                                          perm_thickness[1],
-                                          perm_thickness[2]);
-            }
-            else if (! ((ctf_props.CF > 0.0) && (ctf_props.Kh > 0.0))) {
-                auto msg = fmt::format(R"(Problem with COMPTRAJ keyword
+        auto ctf_kind = ::Opm::Connection::CTFKind::DeckValue;
+        if ((record_props.CF < 0.0) && (record_props.Kh < 0.0)) {
+            ctf_kind = ::Opm::Connection::CTFKind::Defaulted;
+        }
+        else if (! ((record_props.CF > 0.0) && (record_props.Kh > 0.0))) {
+            auto msg = fmt::format(R"(Problem with COMPTRAJ keyword
 In {} line {}
 CF and Kh items for well {} must both be specified or both defaulted/negative)",
-                                       location.filename, location.lineno, wname);
+                                   location.filename, location.lineno, wname);
 
-                throw std::logic_error(msg);
-            }
-
-            // Todo: check what needs to be done for polymerMW module, see
-            // loadCOMPDAT used by the PolymerMW module
+            throw std::logic_error(msg);
+        }
 
-            const auto direction = ::Opm::Connection::Direction::Z;
+        auto ctf_props = std::vector<Connection::CTFProperties>(cells.size());
 
-            ctf_props.re = -1;
+#pragma omp parallel for schedule(static) if (cells.size() >= minParallelConnections)
+        for (std::size_t c = 0; c < cells.size(); ++c) {
+            const auto& [is, cell] = cells[c];
+            ctf_props[c] = comptrajCTFProperties(record_props, *cell,
+                                                 intersections[is].intersectionLengthsInCellCS);
+        }
 
-            {
-                const auto K = permComponents(direction, cell_perm);
-                ctf_props.Ke = std::sqrt(K[0] * K[1]);
-            }
+        const auto direction = ::Opm::Connection::Direction::Z;
 
-            auto prev = std::find_if(this->m_connections.begin(),
-                                     this->m_connections.end(),
-                                     [&ijk](const Connection& c)
-                                     { return c.sameCoordinate(ijk[0], ijk[1], ijk[2]); });
+        auto positions = ConnectionPositions { this->m_connections, cells.size() };
+        for (std::size_t c = 0; c < cells.size(); ++c) {
+            const auto ijk = ecl_grid->getIJK(intersections[cells[c].first].globCellIndex);
+            const auto& cell = *cells[c].second;
 
-            if (prev == this->m_connections.end()) {
+            const auto prev_pos = positions.find(ijk[0], ijk[1], ijk[2]);
+            if (! prev_pos.has_value()) {
                 const std::size_t noConn = this->m_connections.size();
                 this->addConnection(ijk[0], ijk[1], ijk[2],
                                     cell.global_index, state,
-                                    cell.depth, ctf_props, satTableId,
+                                    cell.depth, ctf_props[c], satTableId,
                                     direction, ctf_kind,
                                     noConn, defaultSatTable);
+                positions.add(noConn);
             }
             else {
+                auto prev = this->m_connections.begin() + *prev_pos;
                 const auto compl_num = prev->complnum();
                 const auto css_ind = prev->sort_value();
                 const auto conSegNo = prev->segment();
@@ -733,7 +871,7 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
                     ijk[0], ijk[1], ijk[2],
                     cell.global_index, compl_num,
                     state, direction, ctf_kind, satTableId,
-                    cell.depth, ctf_props,
+                    cell.depth, ctf_props[c],
                     css_ind, defaultSatTable
                 };
 
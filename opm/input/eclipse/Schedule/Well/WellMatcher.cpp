@@ -19,8 +19,6 @@
 
 #include <opm/input/eclipse/Schedule/Well/WellMatcher.hpp>
 
-#include <opm/common/utility/shmatch.hpp>
-
 #include <algorithm>
 #include <functional>
 #include <initializer_list>
@@ -161,18 +159,19 @@ Opm::WellMatcher::wells(const std::string& pattern) const
             : std::vector<std::string> {};
     }
 
-    // Normal pattern matching
+    // Normal pattern matching.  The matches are cached in the NameOrder
+    // object, which is shared between report steps with the same wells.
     if (pattern.find('*') != std::string::npos) {
+        const auto indices = this->m_well_order->match(pattern);
+
         auto names = std::vector<std::string> {};
-        names.reserve(this->m_well_order->size());
+        names.reserve(indices.size());
 
-        std::copy_if(this->m_well_order->begin(),
-                     this->m_well_order->end(),
-                     std::back_inserter(names),
-                     [&pattern](const auto& wname)
-                     { return shmatch(pattern, wname); });
+        std::transform(indices.begin(), indices.end(),
+                       std::back_inserter(names),
+                       [this](const std::size_t i)
+                       { return (*this->m_well_order)[i]; });
 
-        names.shrink_to_fit();
         return names;
     }
 
@@ -18,9 +18,13 @@
 #ifndef OPM_IO_ECLOUTPUT_HPP
 #define OPM_IO_ECLOUTPUT_HPP
 
+#include <algorithm>
+#include <cstddef>
 #include <fstream>
+#include <functional>
 #include <ios>
 #include <string>
+#include <type_traits>
 #include <typeinfo>
 #include <vector>
 
@@ -74,6 +78,45 @@ public:
         }
     }
 
+    // Callback filling block with the array elements [offset, offset +
+    // block.size()) of an array written by the streaming write() below.
+    template <typename T>
+    using BlockGenerator = std::function<void(std::size_t offset, std::vector<T>& block)>;
+
+    // Write an array of size elements without materialising it.  The
+    // elements are pulled from generator in blocks of at most
+    // streamBlockSize elements, and each block is converted and written
+    // before the next one is generated.  The output is identical to
+    // writing the full array with write(name, data).
+    template <typename T>
+    void write(const std::string&       name,
+               const std::size_t        size,
+               const BlockGenerator<T>& generator)
+    {
+        static_assert(std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, double>,
+                      "Streaming output is only supported for INTE, REAL and DOUB arrays");
+
+        const eclArrType arrType = std::is_same_v<T, int> ? INTE
+            : (std::is_same_v<T, float> ? REAL : DOUB);
+        const int element_size = std::is_same_v<T, double> ? 8 : 4;
+
+        if (isFormatted)
+            writeFormattedHeader(name, size, arrType, element_size);
+        else
+            writeBinaryHeader(name, size, arrType, element_size);
+
+        std::vector<T> block;
+        for (std::size_t offset = 0; offset < size; offset += block.size()) {
+            block.resize(std::min(streamBlockSize, size - offset));
+            generator(offset, block);
+
+            if (isFormatted)
+                writeFormattedArray(block);
+            else
+                writeBinaryArray(block);
+        }
+    }
+
     // when this function is used array type will be assumed C0NN (not CHAR).
     // Also in cases where element size is 8 or less, element size will be 8.
 
@@ -88,6 +131,11 @@ public:
     friend class OutputStream::SummarySpecification;
 
 private:
+    // Must be a multiple of the 1000 element record length of both binary
+    // and formatted output, so that a block always ends on a record
+    // boundary.
+    static constexpr std::size_t streamBlockSize = 64 * 1000;
+
     void writeBinaryHeader(const std::string& arrName, int64_t size, eclArrType arrType, int element_size);
 
     template <typename T>
@@ -260,6 +260,15 @@ write(const std::string& kw, const std::vector<double>& data)
     this->writeImpl(kw, data);
 }
 
+void
+Opm::EclIO::OutputStream::Init::
+write(const std::string& kw,
+      const std::size_t  size,
+      const std::function<void(std::size_t, std::vector<float>&)>& generator)
+{
+    this->stream().write<float>(kw, size, generator);
+}
+
 void
 Opm::EclIO::OutputStream::Init::
 open(const std::string& fname,
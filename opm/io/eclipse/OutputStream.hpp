@@ -25,6 +25,8 @@
 
 #include <array>
 #include <chrono>
+#include <cstddef>
+#include <functional>
 #include <ios>
 #include <memory>
 #include <string>
@@ -107,6 +109,19 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         void write(const std::string&         kw,
                    const std::vector<double>& data);
 
+        /// Write single precision floating point data to underlying
+        /// output stream without materialising the full output vector.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] size Number of output values.
+        ///
+        /// \param[in] generator Callback which fills successive blocks
+        ///    of output values.
+        void write(const std::string& kw,
+                   const std::size_t  size,
+                   const std::function<void(std::size_t, std::vector<float>&)>& generator);
+
     private:
         /// Init file output stream.
         std::unique_ptr<EclOutput> stream_;
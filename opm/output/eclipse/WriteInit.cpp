@@ -236,9 +236,32 @@ namespace {
 
     // =================================================================
 
-    std::vector<float> singlePrecision(const std::vector<double>& x)
+    /// Write a single precision array of size elements, with element i
+    /// computed by value(i), without materialising the float copy.
+    template <class Value>
+    void writeSinglePrecision(const std::string&                kw,
+                              const std::size_t                 size,
+                              Value&&                           value,
+                              ::Opm::EclIO::OutputStream::Init& initFile)
+    {
+        initFile.write(kw, size, [&value](const std::size_t offset, std::vector<float>& block)
+        {
+            for (auto i = 0*offset; i < block.size(); ++i) {
+                block[i] = static_cast<float>(value(offset + i));
+            }
+        });
+    }
+
+    void writeSinglePrecision(const std::string&                kw,
+                              const std::vector<double>&        x,
+                              const ::Opm::UnitSystem&          units,
+                              const ::Opm::UnitSystem::measure  unit,
+                              ::Opm::EclIO::OutputStream::Init& initFile)
     {
-        return { x.begin(), x.end() };
+        writeSinglePrecision(kw, x.size(),
+                             [&x, &units, unit](const std::size_t i)
+                             { return units.from_si(unit, x[i]); },
+                             initFile);
     }
 
     ::Opm::RestartIO::LogiHEAD::PVTModel
@@ -321,9 +344,8 @@ namespace {
                          const ::Opm::UnitSystem&          units,
                          ::Opm::EclIO::OutputStream::Init& initFile)
     {
-        auto porv = es.globalFieldProps().porv(true);
-        units.from_si(::Opm::UnitSystem::measure::volume, porv);
-        initFile.write("PORV", singlePrecision(porv));
+        const auto porv = es.globalFieldProps().porv(true);
+        writeSinglePrecision("PORV", porv, units, ::Opm::UnitSystem::measure::volume, initFile);
     }
 
     void writeIntegerCellProperties(const ::Opm::EclipseState&        es,
@@ -354,25 +376,24 @@ namespace {
         const auto length = ::Opm::UnitSystem::measure::length;
         const auto nAct   = grid.getNumActive();
 
-        auto dx    = std::vector<float>{};  dx   .reserve(nAct);
-        auto dy    = std::vector<float>{};  dy   .reserve(nAct);
-        auto dz    = std::vector<float>{};  dz   .reserve(nAct);
-        auto depth = std::vector<float>{};  depth.reserve(nAct);
+        const auto& cellDepth = grid.activeDepth();
+        const auto  cellDims  = grid.activeCellDims();
 
-        for (auto cell = 0*nAct; cell < nAct; ++cell) {
-            const auto  globCell = grid.getGlobalIndex(cell);
-            const auto& dims     = grid.getCellDims(globCell);
-
-            dx   .push_back(units.from_si(length, dims[0]));
-            dy   .push_back(units.from_si(length, dims[1]));
-            dz   .push_back(units.from_si(length, dims[2]));
-            depth.push_back(units.from_si(length, grid.getCellDepth(globCell)));
-        }
+        auto cellDim = [&cellDims, &units](const std::size_t dim)
+        {
+            return [&cellDims, &units, dim](const std::size_t cell)
+            {
+                return units.from_si(length, cellDims[cell][dim]);
+            };
+        };
 
-        initFile.write("DEPTH", depth);
-        initFile.write("DX"   , dx);
-        initFile.write("DY"   , dy);
-        initFile.write("DZ"   , dz);
+        writeSinglePrecision("DEPTH", nAct,
+                             [&cellDepth, &units](const std::size_t cell)
+                             { return units.from_si(length, cellDepth[cell]); },
+                             initFile);
+        writeSinglePrecision("DX", nAct, cellDim(0), initFile);
+        writeSinglePrecision("DY", nAct, cellDim(1), initFile);
+        writeSinglePrecision("DZ", nAct, cellDim(2), initFile);
     }
 
     template <class WriteVector>
@@ -385,10 +406,10 @@ namespace {
                 continue;
             }
 
-            auto data = fp.get_double(prop.name);
-            auto defaulted = fp.defaulted<double>(prop.name);
+            const auto& data = fp.get_double(prop.name);
+            const auto defaulted = fp.defaulted<double>(prop.name);
 
-            write(prop, std::move(defaulted), std::move(data));
+            write(prop, defaulted, data);
         }
     }
 
@@ -402,8 +423,7 @@ namespace {
                 continue;
             }
 
-            auto data = fp.get_double(prop.name);
-            write(prop, std::move(data));
+            write(prop, fp.get_double(prop.name));
         }
     }
 
@@ -415,33 +435,30 @@ namespace {
     {
         if (needDflt) {
             writeCellDoublePropertiesWithDefaultFlag(propList, fp,
-                [&units, &initFile](const CellProperty&   prop,
-                                    std::vector<bool>&&   dflt,
-                                    std::vector<double>&& value)
+                [&units, &initFile](const CellProperty&        prop,
+                                    const std::vector<bool>&   dflt,
+                                    const std::vector<double>& value)
             {
-                units.from_si(prop.unit, value);
-
-                for (auto n = dflt.size(), i = 0*n; i < n; ++i) {
-                    if (dflt[i]) {
-                        // Element defaulted.  Output sentinel value
-                        // (-1.0e+20) to signify defaulted element.
-                        //
-                        // Note: Start as float for roundtripping through
-                        // function singlePrecision().
-                        value[i] = static_cast<double>(-1.0e+20f);
-                    }
-                }
-
-                initFile.write(prop.name, singlePrecision(value));
+                writeSinglePrecision(prop.name, value.size(),
+                    [&units, &prop, &dflt, &value](const std::size_t i)
+                {
+                    // Defaulted elements are output as the sentinel value
+                    // (-1.0e+20) to signify defaulted element.
+                    //
+                    // Note: Start as float for roundtripping through
+                    // single precision output.
+                    return dflt[i]
+                        ? static_cast<double>(-1.0e+20f)
+                        : units.from_si(prop.unit, value[i]);
+                }, initFile);
             });
         }
         else {
             writeCellPropertiesValuesOnly(propList, fp,
-                [&units, &initFile](const CellProperty&   prop,
-                                    std::vector<double>&& value)
+                [&units, &initFile](const CellProperty&        prop,
+                                    const std::vector<double>& value)
             {
-                units.from_si(prop.unit, value);
-                initFile.write(prop.name, singlePrecision(value));
+                writeSinglePrecision(prop.name, value, units, prop.unit, initFile);
             });
         }
     }
@@ -480,10 +497,26 @@ namespace {
                                   const ::Opm::data::Solution&      simProps,
                                   ::Opm::EclIO::OutputStream::Init& initFile)
     {
+        const auto& activeMap = grid.getActiveMap();
+        const auto  nAct      = grid.getNumActive();
+
         for (const auto& prop : simProps) {
-            const auto& value = grid.compressedVector(prop.second.data<double>());
+            const auto& value = prop.second.data<double>();
+
+            if (value.size() == nAct) {
+                writeSinglePrecision(prop.first, nAct,
+                                     [&value](const std::size_t cell) { return value[cell]; },
+                                     initFile);
+                continue;
+            }
+
+            if (value.size() != grid.getCartesianSize())
+                throw std::invalid_argument("Input vector must have full size");
 
-            initFile.write(prop.first, singlePrecision(value));
+            writeSinglePrecision(prop.first, nAct,
+                                 [&value, &activeMap](const std::size_t cell)
+                                 { return value[activeMap[cell]]; },
+                                 initFile);
         }
     }
 
@@ -569,15 +602,12 @@ namespace {
                                       const ::Opm::UnitSystem&           units,
                                       ::Opm::EclIO::OutputStream::Init&  initFile)
     {
-        auto tran = std::vector<double>{};
-        tran.reserve(nnc.size());
-
-        std::transform(nnc.begin(), nnc.end(), std::back_inserter(tran),
-                       [](const auto& nd) { return nd.trans; });
-
-        units.from_si(::Opm::UnitSystem::measure::transmissibility, tran);
+        constexpr auto trans = ::Opm::UnitSystem::measure::transmissibility;
 
-        initFile.write("TRANNNC", singlePrecision(tran));
+        writeSinglePrecision("TRANNNC", nnc.size(),
+                             [&nnc, &units](const std::size_t i)
+                             { return units.from_si(trans, nnc[i].trans); },
+                             initFile);
     }
 
     // output aquifer cell and aquifer connection information for numerical aquifers
@@ -0,0 +1,7 @@
+def run(ecl_state, schedule, report_step, summary_state, actionx_callback):
+    if not "batch_order" in summary_state:
+        summary_state["batch_order"] = 0
+    summary_state["batch_order"] = 10*summary_state["batch_order"] + 2
+
+    actionx_callback("CLOSEWELL", ["P2"])
+    return False
@@ -26,6 +26,8 @@
 #include <stdexcept>
 #include <iostream>
 #include <memory>
+#include <string>
+#include <unordered_set>
 
 #include <opm/input/eclipse/Python/Python.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
@@ -36,6 +38,9 @@
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
 #include <opm/input/eclipse/Schedule/Action/Actions.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionX.hpp>
+#include <opm/input/eclipse/Schedule/Action/PyAction.hpp>
+#include <opm/input/eclipse/Schedule/Action/SimulatorUpdate.hpp>
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
@@ -678,6 +683,50 @@ BOOST_AUTO_TEST_CASE(PYTHON_OPEN_WELL_AT_INVALID_REPORT_STEP) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(MSIM_PYACTION_BATCH) {
+    const auto& deck = Parser().parseFile("msim/MSIM_PYACTION_BATCH.DATA");
+    test_data td( deck );
+    Action::State action_state;
+    SummaryState st;
+
+    // Copy the actions, the scripts modify the schedule they come from.
+    const auto actions = td.schedule[1].actions();
+    auto pyactions = actions.pending_python(action_state);
+    BOOST_REQUIRE_EQUAL(pyactions.size(), 2U);
+
+    {
+        const auto sim_update = td.schedule.runPyActions(1, pyactions, action_state, td.state, st);
+
+        // The scripts run in deck order; BATCH1 appends 1, BATCH2 appends 2.
+        BOOST_CHECK_EQUAL(st.get("batch_order"), 12.0);
+
+        // The result of every script is recorded.
+        BOOST_CHECK(action_state.python_result("BATCH1").value());
+        BOOST_CHECK(!action_state.python_result("BATCH2").value());
+
+        // The returned update holds the changes of both scripts.
+        const auto expected = std::unordered_set<std::string> { "P1", "P2" };
+        BOOST_CHECK(sim_update.affected_wells == expected);
+        BOOST_CHECK(td.schedule.getWell("P1", 1).getStatus() == Well::Status::SHUT);
+        BOOST_CHECK(td.schedule.getWell("P2", 1).getStatus() == Well::Status::SHUT);
+        BOOST_CHECK(td.schedule.getWell("P3", 1).getStatus() == Well::Status::OPEN);
+    }
+
+    // BATCH1 is SINGLE and has run, so only BATCH2 is still pending.
+    pyactions = actions.pending_python(action_state);
+    BOOST_REQUIRE_EQUAL(pyactions.size(), 1U);
+    BOOST_CHECK_EQUAL(pyactions.front()->name(), "BATCH2");
+
+    {
+        const auto sim_update = td.schedule.runPyActions(2, pyactions, action_state, td.state, st);
+        BOOST_CHECK_EQUAL(st.get("batch_order"), 122.0);
+
+        // The update of a batch does not include those of earlier batches.
+        const auto expected = std::unordered_set<std::string> { "P2" };
+        BOOST_CHECK(sim_update.affected_wells == expected);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(MSIM_PYACTION_RETRIEVE_INFO) {
     const auto& deck = Parser().parseFile("msim/MSIM_PYACTION_RETRIEVE_INFO.DATA");
     test_data td( deck );
@@ -76,6 +76,8 @@
 #include <unordered_set>
 #include <vector>
 
+#include <fmt/format.h>
+
 using namespace Opm;
 
 namespace {
@@ -786,6 +788,104 @@ BOOST_AUTO_TEST_CASE(TestMatchingWells_OR)
     BOOST_CHECK( std::find(wells.begin(), wells.end(), "OPY") != wells.end());
 }
 
+BOOST_AUTO_TEST_CASE(TestMatchingWells_UnevaluatedUDQ)
+{
+    Action::AST ast({"WUX", "P*", "<", "5"});
+    SummaryState st(TimeService::now(), 0.0);
+
+    st.update_well_var("P1", "WOPR", 1.0);
+    st.update_well_var("P2", "WOPR", 1.0);
+
+    WListManager wlm;
+    Action::Context context(st, wlm);
+
+    // The well level UDQ has no values yet, so no wells match the pattern.
+    BOOST_CHECK(!ast.eval(context));
+
+    st.update_well_var("P2", "WUX", 1.0);
+    {
+        const auto res = ast.eval(context);
+        BOOST_CHECK(res);
+
+        const auto wells = res.wells();
+        BOOST_CHECK_EQUAL(wells.size(), 1U);
+        BOOST_CHECK_EQUAL(wells[0], "P2");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestMatchingWells_Nested)
+{
+    Action::AST ast({"(", "WOPR", "*", ">", "1.0", "OR", "WWCT", "*", "<", "0.50", ")",
+                     "AND", "WGOR", "OP*", "<", "100", "AND", "FPR", ">", "50"});
+    SummaryState st(TimeService::now(), 0.0);
+
+    st.update_well_var("OPX", "WOPR", 0);
+    st.update_well_var("OPY", "WOPR", 0.50);
+    st.update_well_var("OPZ", "WOPR", 2.0);
+    st.update_well_var("INJ", "WOPR", 2.0);
+
+    st.update_well_var("OPX", "WWCT", 1.0);
+    st.update_well_var("OPY", "WWCT", 0.0);
+    st.update_well_var("OPZ", "WWCT", 1.0);
+    st.update_well_var("INJ", "WWCT", 0.0);
+
+    st.update_well_var("OPX", "WGOR", 10);
+    st.update_well_var("OPY", "WGOR", 200);
+    st.update_well_var("OPZ", "WGOR", 10);
+
+    st.update("FPR", 100);
+
+    WListManager wlm;
+    Action::Context context(st, wlm);
+    {
+        const auto res = ast.eval(context);
+        BOOST_CHECK(res);
+
+        const auto wells = res.wells();
+        BOOST_CHECK_EQUAL(wells.size(), 1U);
+        BOOST_CHECK_EQUAL(wells[0], "OPZ");
+    }
+
+    st.update("FPR", 10);
+    BOOST_CHECK(!ast.eval(context));
+
+    // Operands without wells are not evaluated once the outcome is known.
+    Action::AST ast_or({"FPR", "<", "50", "OR", "FXYZ", ">", "0"});
+    Action::AST ast_and({"FPR", ">", "50", "AND", "FXYZ", ">", "0"});
+    BOOST_CHECK(ast_or.eval(context));
+    BOOST_CHECK(!ast_and.eval(context));
+
+    st.update("FPR", 100);
+    BOOST_CHECK_THROW(ast_or.eval(context), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(TestMatchingWells_ManyWells)
+{
+    // More wells than fit in a single word of the well mask, with matches
+    // in the highest bit of the first word and in the second word.
+    SummaryState st(TimeService::now(), 0.0);
+    for (int well = 0; well < 70; ++well) {
+        st.update_well_var(fmt::format("P{:02d}", well), "WOPR", 0.0);
+    }
+
+    const auto matching = std::vector<std::string> { "P00", "P63", "P64", "P69" };
+    for (const auto& well : matching) {
+        st.update_well_var(well, "WOPR", 2.0);
+    }
+
+    WListManager wlm;
+    Action::Context context(st, wlm);
+
+    Action::AST ast({"WOPR", "P*", ">", "1.0", "AND", "WOPR", "P*", "<", "3.0"});
+    const auto res = ast.eval(context);
+    BOOST_REQUIRE(res);
+
+    auto wells = res.wells();
+    std::sort(wells.begin(), wells.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(wells.begin(), wells.end(),
+                                  matching.begin(), matching.end());
+}
+
 BOOST_AUTO_TEST_CASE(TestWLIST)
 {
     WListManager wlm;
@@ -1226,6 +1326,98 @@ END
     BOOST_CHECK(wellpi.empty());
 }
 
+BOOST_AUTO_TEST_CASE(Action_Reiterate_Overridden)
+{
+    const auto deck_string = std::string{ R"(
+SCHEDULE
+
+WELSPECS
+    'PROD1' 'G1'  1 1 10 'OIL' /
+    'INJ1'  'G1'  1 1 10 'WAT' /
+/
+
+GCONPROD
+'G1' 'ORAT' 100  /
+/
+
+GCONINJE
+'G1' 'WATER' 'RATE' 1000 /
+/
+
+ACTIONX
+'A' /
+FPR < 100 /
+/
+
+GCONPROD
+   'G1'  'ORAT' 200 /
+/
+
+GCONINJE
+'G1' 'WATER' 'RATE' 5000 /
+/
+
+ENDACTIO
+
+ACTIONX
+'B' /
+FPR < 100 /
+/
+
+GCONPROD
+   'G1'  'ORAT' 250 /
+/
+
+ENDACTIO
+
+TSTEP
+10 /
+
+GCONPROD
+'G1' 'ORAT' 300  /
+/
+
+TSTEP
+10 10 /
+END
+)"};
+
+    const auto unit_system =  UnitSystem::newMETRIC();
+    const auto st = SummaryState{ TimeService::now(), 0.0 };
+    const auto rate = [&unit_system](const double r)
+    {
+        return unit_system.to_si(UnitSystem::measure::liquid_surface_rate, r);
+    };
+
+    Schedule sched = make_schedule(deck_string);
+    const auto num_steps = sched.size();
+
+    auto check_group = [&sched, &st](const std::size_t step, const double oil_target, const double inj_rate)
+    {
+        const auto& group = sched.getGroup("G1", step);
+        BOOST_CHECK_CLOSE(group.productionControls(st).oil_target, oil_target, 1e-5);
+        BOOST_CHECK_CLOSE(group.injectionControls(Phase::WATER, st).surface_max_rate, inj_rate, 1e-5);
+    };
+
+    // Action B is overridden by the GCONPROD keyword at report step 1, and
+    // the remaining report steps are unaffected.
+    const auto action_b = sched[0].actions.get()["B"];
+    sched.applyAction(0, action_b, {}, std::unordered_map<std::string,double>{});
+    BOOST_CHECK_EQUAL(sched.size(), num_steps);
+    check_group(0, rate(250), rate(1000));
+    for (std::size_t step = 1; step < num_steps; ++step)
+        check_group(step, rate(300), rate(1000));
+
+    // The injection rate set by action A is not overridden and must be
+    // carried through to the end of the schedule.
+    const auto action_a = sched[0].actions.get()["A"];
+    sched.applyAction(0, action_a, {}, std::unordered_map<std::string,double>{});
+    BOOST_CHECK_EQUAL(sched.size(), num_steps);
+    check_group(0, rate(200), rate(5000));
+    for (std::size_t step = 1; step < num_steps; ++step)
+        check_group(step, rate(300), rate(5000));
+}
+
 namespace {
 
 bool has_well(const std::vector<std::string>& wells,
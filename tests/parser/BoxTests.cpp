@@ -205,3 +205,44 @@ BOOST_AUTO_TEST_CASE(TestKeywordBox2) {
         BOOST_CHECK_EQUAL(il[i].active_index, 98 + i*100);
     }
 }
+
+BOOST_AUTO_TEST_CASE(TestIndexListRanges) {
+    Opm::GridDims gridDims(10, 7, 6);
+
+    // Full grid with all cells active is a single run
+    const Opm::Box global_box(gridDims, allActive(), identityMapping());
+    BOOST_CHECK_EQUAL(global_box.index_list().size(), gridDims.getCartesianSize());
+    BOOST_REQUIRE_EQUAL(global_box.index_list().ranges().size(), 1U);
+    BOOST_CHECK_EQUAL(global_box.global_index_list().ranges().size(), 1U);
+
+    // Sub box with one run per row
+    const Opm::Box sub_box(gridDims, allActive(), identityMapping(), 2,5,1,3,0,1);
+    const auto& index_list = sub_box.index_list();
+    BOOST_CHECK_EQUAL(index_list.size(), 4U*3U*2U);
+    BOOST_REQUIRE_EQUAL(index_list.ranges().size(), 3U*2U);
+
+    std::size_t data_index = 0;
+    for (const auto& cell : index_list) {
+        const auto ijk = gridDims.getIJK(cell.global_index);
+        BOOST_CHECK(ijk[0] >= 2 && ijk[0] <= 5);
+        BOOST_CHECK(ijk[1] >= 1 && ijk[1] <= 3);
+        BOOST_CHECK(ijk[2] <= 1);
+        BOOST_CHECK_EQUAL(cell.data_index, data_index);
+        BOOST_CHECK_EQUAL(index_list[data_index].global_index, cell.global_index);
+        ++data_index;
+    }
+    BOOST_CHECK_EQUAL(data_index, index_list.size());
+    BOOST_CHECK_THROW(index_list[index_list.size()], std::out_of_range);
+
+    // Inactive cells split the runs of active cells
+    auto everyOther = Opm::Box::IsActive {
+        [](const std::size_t global_index) { return (global_index % 20) != 5; }
+    };
+    auto activeIdx = Opm::Box::ActiveIdx {
+        [](const std::size_t global_index) { return global_index - (global_index + 14) / 20; }
+    };
+    const Opm::Box split_box(gridDims, everyOther, activeIdx);
+    BOOST_CHECK_EQUAL(split_box.index_list().size(), gridDims.getCartesianSize() - 21U);
+    BOOST_CHECK_EQUAL(split_box.index_list().ranges().size(), 22U);
+    BOOST_CHECK_EQUAL(split_box.global_index_list().ranges().size(), 1U);
+}
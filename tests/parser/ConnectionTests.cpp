@@ -50,6 +50,9 @@
 #include <cstddef>
 #include <stdexcept>
 #include <ostream>
+#include <string>
+
+#include <fmt/format.h>
 
 namespace {
     double cp_rm3_per_db()
@@ -312,6 +315,131 @@ COMPDAT
 }
 
 
+BOOST_AUTO_TEST_CASE(loadCOMPDAT_Prefetched_Cells)
+{
+    const auto deck = Opm::Parser{}.parseString(R"(GRID
+
+PERMX
+  1000*0.10 /
+
+COPY
+  'PERMX' 'PERMZ' /
+  'PERMX' 'PERMY' /
+/
+
+PORO
+  1000*0.3 /
+
+SCHEDULE
+
+COMPDAT
+    'WELL'  1  1   1   3 'OPEN' 1*    1*   0.311   1*  1*     1*  'Z'  21.925 /
+    'WELL'  2  2   4   4 'OPEN' 1*    1*   0.311   1*  1*     1*  'Z'  21.925 /
+/)");
+
+    const auto wdfac = Opm::WDFAC{};
+    const auto loc = Opm::KeywordLocation{};
+
+    Opm::EclipseGrid grid { 10, 10, 10 };
+    const Opm::FieldPropsManager field_props {
+        deck, Opm::Phases{true, true, true}, grid, Opm::TableManager{}
+    };
+
+    Opm::CompletedCells cells(grid);
+    Opm::CompletedCells prefetched_cells(grid);
+    const auto sg = Opm::ScheduleGrid { grid, field_props, cells };
+    const auto prefetched_sg = Opm::ScheduleGrid { grid, field_props, prefetched_cells };
+
+    // Cell (6,6,6) is never connected and (20,1,1) is outside the grid.
+    prefetched_sg.prefetch({ {0, 0, 0}, {0, 0, 1}, {0, 0, 2}, {1, 1, 3},
+                             {0, 0, 0}, {5, 5, 5}, {19, 0, 0} });
+
+    Opm::WellConnections connections { Opm::Connection::Order::TRACK, 10, 10 };
+    Opm::WellConnections prefetched_connections { Opm::Connection::Order::TRACK, 10, 10 };
+    for (const auto& rec : deck["COMPDAT"][0]) {
+        connections.loadCOMPDAT(rec, sg, "WELL", wdfac, loc);
+        prefetched_connections.loadCOMPDAT(rec, prefetched_sg, "WELL", wdfac, loc);
+    }
+
+    BOOST_CHECK_EQUAL(prefetched_connections.size(), std::size_t{4});
+    BOOST_CHECK(prefetched_connections == connections);
+    BOOST_CHECK(prefetched_cells == cells);
+    BOOST_CHECK_THROW(prefetched_cells.get(5, 5, 5), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(loadCOMPDAT_Many_Layers)
+{
+    // One record completing all layers, and then re-completing the lower
+    // half, must give the same connections as one record per layer.
+    std::string single_records;
+    for (int k = 1; k <= 100; ++k) {
+        single_records += fmt::format("    'WELL'  1  1  {0}  {0} 'OPEN' 1*  1*  0.311  1*  1*  1*  'Z'  21.925 /\n", k);
+    }
+    for (int k = 51; k <= 100; ++k) {
+        single_records += fmt::format("    'WELL'  1  1  {0}  {0} 'SHUT' 1*  1*  0.216  1*  1*  1*  'Z'  21.925 /\n", k);
+    }
+
+    const auto grid_section = std::string { R"(GRID
+
+PERMX
+  400*0.10 /
+
+COPY
+  'PERMX' 'PERMZ' /
+  'PERMX' 'PERMY' /
+/
+
+PORO
+  400*0.3 /
+
+SCHEDULE
+
+COMPDAT
+)" };
+
+    const auto many_layers = Opm::Parser{}.parseString(grid_section + R"(
+    'WELL'  1  1   1 100 'OPEN' 1*  1*  0.311  1*  1*  1*  'Z'  21.925 /
+    'WELL'  1  1  51 100 'SHUT' 1*  1*  0.216  1*  1*  1*  'Z'  21.925 /
+/)");
+
+    const auto single_layers = Opm::Parser{}.parseString(grid_section + single_records + "/\n");
+
+    const auto wdfac = Opm::WDFAC{};
+    const auto loc = Opm::KeywordLocation{};
+
+    const auto load = [&wdfac, &loc](const Opm::Deck& deck)
+    {
+        Opm::EclipseGrid grid { 2, 2, 100 };
+        const Opm::FieldPropsManager field_props {
+            deck, Opm::Phases{true, true, true}, grid, Opm::TableManager{}
+        };
+
+        Opm::CompletedCells cells(grid);
+        const auto sg = Opm::ScheduleGrid { grid, field_props, cells };
+
+        Opm::WellConnections connections { Opm::Connection::Order::TRACK, 0, 0 };
+        for (const auto& rec : deck["COMPDAT"][0]) {
+            connections.loadCOMPDAT(rec, sg, "WELL", wdfac, loc);
+        }
+
+        return connections;
+    };
+
+    const auto connections = load(many_layers);
+    BOOST_REQUIRE_EQUAL(connections.size(), std::size_t{100});
+    BOOST_CHECK(connections == load(single_layers));
+
+    for (std::size_t c = 0; c < connections.size(); ++c) {
+        BOOST_CHECK_EQUAL(connections[c].getK(), static_cast<int>(c));
+        BOOST_CHECK_EQUAL(connections[c].complnum(), static_cast<int>(c) + 1);
+        BOOST_CHECK(connections[c].state() == ((c < 50) ? Opm::Connection::State::OPEN
+                                                        : Opm::Connection::State::SHUT));
+        BOOST_CHECK_GT(connections[c].CF(), 0.0);
+    }
+
+    BOOST_CHECK_CLOSE(connections[99].rw(), 0.108, 1.0e-8);
+}
+
 BOOST_AUTO_TEST_CASE(loadCOMPDATTESTSPE1) {
     Opm::Parser parser;
 
@@ -3426,3 +3426,48 @@ PORO
     SPIDER with DR/DRV, DTHETA/DTHETAV, DZ/DZV and TOPS creates a spider grid)");
     });
 }
+
+BOOST_AUTO_TEST_CASE(ActiveGeometryBatch)
+{
+    const std::string deck_data = R"(
+RUNSPEC
+DIMENS
+3 2 2 /
+GRID
+DX
+12*100 /
+DY
+12*50 /
+DZ
+6*5 6*10 /
+TOPS
+1000 1002 1004 1001 1003 1005 /
+ACTNUM
+1 1 0 1 1 1
+1 0 1 1 1 1 /
+)";
+
+    Opm::Parser parser;
+    Opm::EclipseGrid grid(parser.parseString(deck_data));
+    BOOST_CHECK_EQUAL(grid.getNumActive(), 10U);
+
+    const auto& volume = grid.activeVolume();
+    const auto& depth = grid.activeDepth();
+    const auto dims = grid.activeCellDims();
+    BOOST_CHECK_EQUAL(volume.size(), grid.getNumActive());
+    BOOST_CHECK_EQUAL(depth.size(), grid.getNumActive());
+    BOOST_CHECK_EQUAL(dims.size(), grid.getNumActive());
+
+    // Per-cell reference computed without the cached batch results.
+    const Opm::EclipseGrid ref(grid.getNXYZ(), grid.getCOORD(), grid.getZCORN(), grid.getACTNUM().data());
+    for (std::size_t active_index = 0; active_index < grid.getNumActive(); ++active_index) {
+        const auto global_index = grid.getGlobalIndex(active_index);
+        BOOST_CHECK_CLOSE(volume[active_index], ref.getCellVolume(global_index), 1e-10);
+        BOOST_CHECK_CLOSE(depth[active_index], ref.getCellDepth(global_index), 1e-10);
+        BOOST_CHECK_CLOSE(grid.getCellDepth(global_index), ref.getCellDepth(global_index), 1e-10);
+
+        const auto ref_dims = ref.getCellDims(global_index);
+        for (std::size_t d = 0; d < 3; ++d)
+            BOOST_CHECK_CLOSE(dims[active_index][d], ref_dims[d], 1e-10);
+    }
+}
@@ -111,6 +111,26 @@ BOOST_AUTO_TEST_CASE(AddFaceToFaults) {
 
 }
 
+BOOST_AUTO_TEST_CASE(FaultFaceIndices) {
+    Opm::Fault fault("FAULT1");
+    fault.addFace( Opm::FaultFace( 10,10,10, 0, 2, 0, 0, 0, 0, Opm::FaceDir::YPlus ) );
+    fault.addFace( Opm::FaultFace( 10,10,10, 4, 4, 1, 2, 0, 0, Opm::FaceDir::XPlus ) );
+    fault.addFace( Opm::FaultFace( 10,10,10, 0, 2, 0, 0, 1, 1, Opm::FaceDir::YPlus ) );
+
+    const auto& indices = fault.getFaceIndices();
+    BOOST_REQUIRE_EQUAL( indices.size() , 2U );
+
+    BOOST_CHECK_EQUAL( indices[0].first , Opm::FaceDir::YPlus );
+    const std::vector<std::size_t> yplus = { 0, 1, 2, 100, 101, 102 };
+    BOOST_CHECK_EQUAL_COLLECTIONS( indices[0].second.begin(), indices[0].second.end(),
+                                   yplus.begin(), yplus.end() );
+
+    BOOST_CHECK_EQUAL( indices[1].first , Opm::FaceDir::XPlus );
+    const std::vector<std::size_t> xplus = { 14, 24 };
+    BOOST_CHECK_EQUAL_COLLECTIONS( indices[1].second.begin(), indices[1].second.end(),
+                                   xplus.begin(), xplus.end() );
+}
+
 
 
 BOOST_AUTO_TEST_CASE(CreateFaultCollection) {
@@ -914,6 +914,155 @@ OPERATE
     BOOST_CHECK_EQUAL(multz[3], 0.75);
 }
 
+BOOST_AUTO_TEST_CASE(OPERATE_SAME_TARGET) {
+    // Consecutive records on the same target and box are applied in one
+    // pass; the result must still reflect the record order.
+    std::string deck_string = R"(
+GRID
+
+PORO
+   6*0.1 /
+
+NTG
+   6*0.5 /
+
+OPERATE
+    PORO   1  3   1  2   1   1  'MULTX'    PORO 2 /
+    PORO   1  3   1  2   1   1  'ADDX'     PORO 0.1 /
+    PORO   1  3   1  2   1   1  'MAXLIM'   PORO 0.25 /
+    PORO   1  3   1  2   1   1  'MULTIPLY' NTG /
+    PORO   1  3   1  1   1   1  'ADDX'     PORO 0.5 /
+    NTG    1  3   1  1   1   1  'MULTX'    PORO 2 /
+/
+)";
+
+    EclipseGrid grid(3,2,1);
+    Deck deck = Parser{}.parseString(deck_string);
+    FieldPropsManager fpm(deck, Phases{true, true, true}, grid, TableManager());
+    const auto& poro = fpm.get_double("PORO");
+    const auto& ntg = fpm.get_double("NTG");
+    for (std::size_t i = 0; i < 3; i++) {
+        BOOST_CHECK_CLOSE(poro[i], 0.625, 1e-10);
+        BOOST_CHECK_CLOSE(poro[i + 3], 0.125, 1e-10);
+        BOOST_CHECK_CLOSE(ntg[i], 1.25, 1e-10);
+        BOOST_CHECK_CLOSE(ntg[i + 3], 0.5, 1e-10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SHARED_DEFAULT_ARRAYS) {
+    // Untouched multiplier arrays share one pooled array, modified arrays
+    // get storage of their own.
+    std::string deck_string = R"(
+GRID
+
+PORO
+   6*0.1 /
+
+MULTX
+   6*2.0 /
+
+EQUALS
+   MULTZ 3.0 1 1 1 1 1 1 /
+/
+)";
+
+    EclipseGrid grid(3,2,1);
+    Deck deck = Parser{}.parseString(deck_string);
+    FieldPropsManager fpm(deck, Phases{true, true, true}, grid, TableManager());
+    const auto& multx = fpm.get_double("MULTX");
+    const auto& multy = fpm.get_double("MULTY");
+    const auto& multz = fpm.get_double("MULTZ");
+    const auto& multxm = fpm.get_double("MULTX-");
+
+    BOOST_CHECK_EQUAL(multy.data(), multxm.data());
+    BOOST_CHECK(multx.data() != multy.data());
+    BOOST_CHECK(multz.data() != multy.data());
+
+    for (std::size_t i = 0; i < 6; i++) {
+        BOOST_CHECK_EQUAL(multx[i], 2.0);
+        BOOST_CHECK_EQUAL(multy[i], 1.0);
+        BOOST_CHECK_EQUAL(multxm[i], 1.0);
+        BOOST_CHECK_EQUAL(multz[i], i == 0 ? 3.0 : 1.0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(OPERATE_SAME_TARGET_DERIVED_SOURCE) {
+    // PORV does not exist before the second record, and must be computed
+    // from the PORO values of the first record.
+    std::string deck_string = R"(
+GRID
+
+PORO
+   6*0.1 /
+
+OPERATE
+    PORO   1  3   1  2   1   1  'MULTX'    PORO 2 /
+    PORO   1  3   1  2   1   1  'COPY'     PORV /
+/
+)";
+
+    EclipseGrid grid(3,2,1);
+    Deck deck = Parser{}.parseString(deck_string);
+    FieldPropsManager fpm(deck, Phases{true, true, true}, grid, TableManager());
+    const auto& poro = fpm.get_double("PORO");
+    for (std::size_t i = 0; i < 6; i++) {
+        BOOST_CHECK_CLOSE(poro[i], 0.2 * grid.getCellVolume(i), 1e-10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(OPERATE_SAME_TARGET_DEFAULTED) {
+    // NTG is defaulted, i.e., the target starts out in shared storage, and
+    // the second record must see the result of the first.
+    std::string deck_string = R"(
+GRID
+
+PORO
+   6*0.1 /
+
+OPERATE
+    NTG   1  3   1  2   1   1  'MULTX'    NTG 0.5 /
+    NTG   1  3   1  2   1   1  'MULTX'    NTG 0.5 /
+/
+)";
+
+    EclipseGrid grid(3,2,1);
+    Deck deck = Parser{}.parseString(deck_string);
+    FieldPropsManager fpm(deck, Phases{true, true, true}, grid, TableManager());
+    const auto& ntg = fpm.get_double("NTG");
+    for (std::size_t i = 0; i < 6; i++) {
+        BOOST_CHECK_CLOSE(ntg[i], 0.25, 1e-10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(OPERATE_SAME_TARGET_ALIASED_SOURCE) {
+    // PERMTHT is an alias of the existing PERMY array, so both records are
+    // applied in one pass.
+    std::string deck_string = R"(
+GRID
+
+PERMTHT
+   6*1000 /
+
+PERMZ
+   6*5 /
+
+OPERATE
+    PERMZ   1  3   1  2   1   1  'MULTX'    PERMZ   2 /
+    PERMZ   1  3   1  2   1   1  'POLY'     PERMTHT 3 1 /
+/
+)";
+
+    UnitSystem unit_system(UnitSystem::UnitType::UNIT_TYPE_METRIC);
+    auto to_si = [&unit_system](double raw_value) { return unit_system.to_si(UnitSystem::measure::permeability, raw_value); };
+    EclipseGrid grid(3,2,1);
+    Deck deck = Parser{}.parseString(deck_string);
+    FieldPropsManager fpm(deck, Phases{true, true, true}, grid, TableManager());
+    const auto& permz = fpm.get_double("PERMZ");
+    for (std::size_t i = 0; i < 6; i++) {
+        BOOST_CHECK_CLOSE(permz[i], to_si(3010), 1e-10);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(EPS_Props_Inconsistent) {
     BOOST_CHECK_THROW(const auto deck = Opm::Parser{}.parseString(R"(RUNSPEC
 DIMENS
@@ -1340,6 +1489,60 @@ END
     }
 } // namespace Anonymous
 
+BOOST_AUTO_TEST_CASE(Satfunc_Init_Depth_Tables) {
+    // Table 2 has a defaulted SWCO entry, which is interpolated from the
+    // other rows.  Table 3 has no usable SWCO values, in which case the
+    // value of the cell's SATNUM table is used.
+    const auto deck = Parser{}.parseString(R"(RUNSPEC
+ENDSCALE
+NODIR REVERS 3 /
+TABDIMS
+2 /
+PROPS
+ENPTVD
+1000.0 0.10 0.20 1.0 0.0 0.04 1.0 0.18 0.22
+2000.0 0.20 0.20 1.0 0.0 0.04 1.0 0.18 0.22 /
+1000.0 0.30 0.20 1.0 0.0 0.04 1.0 0.18 0.22
+1500.0 1*   0.20 1.0 0.0 0.04 1.0 0.18 0.22
+2000.0 0.40 0.20 1.0 0.0 0.04 1.0 0.18 0.22 /
+1000.0 NaN  0.20 1.0 0.0 0.04 1.0 0.18 0.22
+2000.0 NaN  0.20 1.0 0.0 0.04 1.0 0.18 0.22 /
+)");
+
+    const auto tm = TableManager { deck };
+    BOOST_REQUIRE(tm.useEnptvd());
+
+    auto ep = satfunc::RawTableEndPoints{};
+    ep.connate.water = { 0.05, 0.07 };
+
+    const auto cell_depth = std::vector<double> { 500.0, 1500.0, 2500.0, 1250.0, 1500.0 };
+    const auto satnum     = std::vector<int>    { 1, 2, 1, 2, 2 };
+    const auto endnum     = std::vector<int>    { 1, 1, 1, 2, 3 };
+
+    const auto swl = satfunc::init("SWL", tm, Phases{true, true, true}, ep, cell_depth, satnum, endnum);
+    BOOST_REQUIRE_EQUAL(swl.size(), cell_depth.size());
+    BOOST_CHECK_CLOSE(swl[0], 0.10, 1.0e-10);
+    BOOST_CHECK_CLOSE(swl[1], 0.15, 1.0e-10);
+    BOOST_CHECK_CLOSE(swl[2], 0.20, 1.0e-10);
+    BOOST_CHECK_CLOSE(swl[3], 0.325, 1.0e-10); // Defaulted entry interpolated
+    BOOST_CHECK_CLOSE(swl[4], 0.07, 1.0e-10);  // No usable value => SATNUM table value
+
+    const auto no_depth_tables = TableManager { Parser{}.parseString(R"(RUNSPEC
+TABDIMS
+2 /
+)") };
+    const auto swl_sat = satfunc::init("SWL", no_depth_tables, Phases{true, true, true}, ep, cell_depth, satnum, endnum);
+    BOOST_CHECK_CLOSE(swl_sat[0], 0.05, 1.0e-10);
+    BOOST_CHECK_CLOSE(swl_sat[1], 0.07, 1.0e-10);
+    BOOST_CHECK_CLOSE(swl_sat[2], 0.05, 1.0e-10);
+    BOOST_CHECK_CLOSE(swl_sat[3], 0.07, 1.0e-10);
+    BOOST_CHECK_CLOSE(swl_sat[4], 0.07, 1.0e-10);
+
+    const auto bad_satnum = std::vector<int> { 1, 2, 0, 2, 2 };
+    BOOST_CHECK_THROW(satfunc::init("SWL", tm, Phases{true, true, true}, ep, cell_depth, bad_satnum, endnum),
+                      std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE(RawTableEndPoints_Family_I_TolCrit_Zero) {
     const auto es = ::Opm::EclipseState {
         ::Opm::Parser{}.parseString(satfunc_model_setup() + satfunc_family_I() + end())
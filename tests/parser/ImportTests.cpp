@@ -33,6 +33,7 @@
 #include <filesystem>
 #include <fstream>
 
+#include <opm/input/eclipse/Parser/ParserKeywords/F.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/I.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/M.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/P.hpp>
@@ -75,10 +76,42 @@ BOOST_AUTO_TEST_CASE(CreateImportContainer) {
 
     BOOST_CHECK_EQUAL(deck.size(), 4);
     BOOST_CHECK( deck.hasKeyword<ParserKeywords::MAPAXES>());
+
+    const std::vector<double> poro = {0, 1, 2, 3, 4};
+    const std::vector<double> permx = {10, 20, 30, 40};
+    const std::vector<int> fipnum = {100, 200, 300, 400};
+    const auto& poro_data = deck.get<ParserKeywords::PORO>().back().getRawDoubleData();
+    const auto& permx_data = deck.get<ParserKeywords::PERMX>().back().getRawDoubleData();
+    const auto& fipnum_data = deck.get<ParserKeywords::FIPNUM>().back().getIntData();
+    BOOST_CHECK_EQUAL_COLLECTIONS(poro_data.begin(), poro_data.end(), poro.begin(), poro.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(permx_data.begin(), permx_data.end(), permx.begin(), permx.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(fipnum_data.begin(), fipnum_data.end(), fipnum.begin(), fipnum.end());
+    BOOST_CHECK_EQUAL(deck[0].name(), "PORO");
+    BOOST_CHECK_EQUAL(deck[3].name(), "MAPAXES");
 }
 
 
 
+BOOST_AUTO_TEST_CASE(ImportContainerIntegerTypeMismatch) {
+    WorkArea work;
+    auto unit_system = UnitSystem::newMETRIC();
+    Parser parser;
+
+    {
+        EclIO::EclOutput output {"REAL_FIPNUM", false};
+        output.write<double>("PORO", {0, 1, 2, 3});
+        output.write<float>("FIPNUM", {1, 2, 3, 4});
+    }
+    BOOST_CHECK_THROW(ImportContainer(parser, unit_system, "REAL_FIPNUM", false, 0), std::logic_error);
+
+    {
+        EclIO::EclOutput output {"CHAR_FIPNUM", false};
+        output.write<std::string>("FIPNUM", {"A", "B"});
+    }
+    BOOST_CHECK_THROW(ImportContainer(parser, unit_system, "CHAR_FIPNUM", false, 0), std::logic_error);
+}
+
+
 BOOST_AUTO_TEST_CASE(ImportDeck) {
     const std::string deck_string = R"(
 RUNSPEC
@@ -317,6 +317,94 @@ BOOST_AUTO_TEST_CASE(MULTREGT_COPY_MULTNUM) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(BatchAllDirections) {
+    Opm::Deck deck = createDefaultedRegions();
+    Opm::TableManager tm(deck);
+    Opm::EclipseGrid grid(deck);
+    Opm::FieldPropsManager fp(deck, Opm::Phases{true, true, true}, grid, tm);
+
+    std::vector<const Opm::DeckKeyword*> keywords;
+    for (const auto& keyword : deck["MULTREGT"]) {
+        keywords.push_back(&keyword);
+    }
+    Opm::MULTREGTScanner scanner(grid, &fp, keywords);
+
+    for (const auto faceDir : { Opm::FaceDir::XPlus, Opm::FaceDir::XMinus,
+                                Opm::FaceDir::YPlus, Opm::FaceDir::YMinus,
+                                Opm::FaceDir::ZPlus, Opm::FaceDir::ZMinus })
+    {
+        std::vector<double> multipliers(grid.getCartesianSize(), 2.0);
+        scanner.applyRegionMultipliers(faceDir, multipliers);
+
+        for (std::size_t k = 0; k < grid.getNZ(); ++k) {
+            for (std::size_t j = 0; j < grid.getNY(); ++j) {
+                for (std::size_t i = 0; i < grid.getNX(); ++i) {
+                    auto ijk = std::array<int, 3> { int(i), int(j), int(k) };
+                    const auto face = Opm::FaceDir::ToIntersectionIndex(faceDir);
+                    const auto comp = face / 2;
+                    const auto step = (face % 2 == 1) ? 1 : -1;
+                    ijk[comp] += step;
+
+                    const auto g = grid.getGlobalIndex(i, j, k);
+                    auto expected = 2.0;
+                    if ((ijk[comp] >= 0) && (ijk[comp] < grid.getNXYZ()[comp])) {
+                        const auto n = grid.getGlobalIndex(ijk[0], ijk[1], ijk[2]);
+                        expected *= scanner.getRegionMultiplier(g, n, faceDir);
+                    }
+
+                    BOOST_CHECK_EQUAL(multipliers[g], expected);
+                }
+            }
+        }
+    }
+
+    std::vector<double> wrong_size(grid.getCartesianSize() + 1, 1.0);
+    BOOST_CHECK_THROW(scanner.applyRegionMultipliers(Opm::FaceDir::XPlus, wrong_size), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(SparseRegionIds) {
+    // Region IDs spanning a large range use the hashed region pair lookup.
+    Opm::Deck deck = Opm::Parser{}.parseString(R"(RUNSPEC
+DIMENS
+3 1 1 /
+GRID
+DX
+3*0.25 /
+DY
+3*0.25 /
+DZ
+3*0.25 /
+TOPS
+3*0.25 /
+MULTNUM
+1 100000 2000000 /
+MULTREGT
+1  100000   0.50  X  ALL  M /
+100000  2000000   0.25  X  ALL  M /
+2000000  2000000   0.10  X  ALL  M /
+/
+EDIT
+)");
+
+    Opm::TableManager tm(deck);
+    Opm::EclipseGrid grid(deck);
+    Opm::FieldPropsManager fp(deck, Opm::Phases{true, true, true}, grid, tm);
+
+    std::vector<const Opm::DeckKeyword*> keywords { &deck["MULTREGT"].back() };
+    Opm::MULTREGTScanner scanner(grid, &fp, keywords);
+
+    BOOST_CHECK_CLOSE(scanner.getRegionMultiplier(0, 1, Opm::FaceDir::XPlus), 0.50, 1.0e-8);
+    BOOST_CHECK_CLOSE(scanner.getRegionMultiplier(1, 0, Opm::FaceDir::XMinus), 0.50, 1.0e-8);
+    BOOST_CHECK_CLOSE(scanner.getRegionMultiplier(1, 2, Opm::FaceDir::XPlus), 0.025, 1.0e-8);
+    BOOST_CHECK_CLOSE(scanner.getRegionMultiplier(0, 1, Opm::FaceDir::YPlus), 1.0, 1.0e-8);
+
+    std::vector<double> multipliers(3, 1.0);
+    scanner.applyRegionMultipliers(Opm::FaceDir::XPlus, multipliers);
+    BOOST_CHECK_CLOSE(multipliers[0], 0.50, 1.0e-8);
+    BOOST_CHECK_CLOSE(multipliers[1], 0.025, 1.0e-8);
+    BOOST_CHECK_CLOSE(multipliers[2], 1.0, 1.0e-8);
+}
+
 BOOST_AUTO_TEST_SUITE_END()     // Basic
 
 // ===========================================================================
@@ -26,13 +26,20 @@
 #include <filesystem>
 #include <iostream>
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/InputErrorAction.hpp>
+#include <opm/input/eclipse/Deck/DeckItem.hpp>
+#include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/input/eclipse/Deck/DeckRecord.hpp>
 
+#include <tests/WorkArea.hpp>
+
+#include <fstream>
 #include <iostream>
 
 inline std::string prefix() {
@@ -147,3 +154,123 @@ BOOST_AUTO_TEST_CASE(ParserKeyword_includeWrongCase) {
 #endif
 }
 
+
+
+namespace {
+    void write_file(const std::string& fname, const std::string& content) {
+        std::ofstream stream(fname);
+        stream << content;
+    }
+
+    int poro_count(const Opm::Deck& deck) {
+        return deck["PORO"].back().getRecord(0).getItem(0).data_size();
+    }
+
+    bool same_keywords(const Opm::Deck& deck1, const Opm::Deck& deck2) {
+        return std::equal(deck1.begin(), deck1.end(), deck2.begin(), deck2.end());
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(DeckCache) {
+    WorkArea work;
+    write_file("CASE.DATA", R"(
+RUNSPEC
+DIMENS
+  2 1 1 /
+GRID
+INCLUDE
+  'grid.inc' /
+SCHEDULE
+INCLUDE
+  'sched.inc' /
+)");
+    write_file("grid.inc", "PORO\n 2*0.25 /\n");
+    write_file("sched.inc", "TSTEP\n 10 /\n");
+
+    Opm::Parser parser;
+    parser.enableDeckCache("cache");
+
+    const auto deck1 = parser.parseFile("CASE.DATA");
+    BOOST_CHECK(!std::filesystem::is_empty("cache"));
+
+    const auto deck2 = parser.parseFile("CASE.DATA");
+    BOOST_CHECK(same_keywords(deck1, deck2));
+    BOOST_CHECK(deck2.tree().includes(std::filesystem::canonical("CASE.DATA"), "grid.inc"));
+
+    // Rewrite grid.inc with unchanged size and modification time; the
+    // cached GRID keywords are then trusted even though the SCHEDULE
+    // include is parsed again.
+    const auto grid_mtime = std::filesystem::last_write_time("grid.inc");
+    write_file("grid.inc", "PORO\n 1*0.25 /\n");
+    std::filesystem::last_write_time("grid.inc", grid_mtime);
+    write_file("sched.inc", "TSTEP\n 10 20 /\n");
+
+    const auto deck3 = parser.parseFile("CASE.DATA");
+    BOOST_CHECK_EQUAL(poro_count(deck3), 2);
+    BOOST_CHECK_EQUAL(deck3["TSTEP"].back().getRecord(0).getItem(0).data_size(), 2U);
+    BOOST_CHECK(deck3.tree().includes(std::filesystem::canonical("CASE.DATA"), "grid.inc"));
+
+    // Changing the modification time forces a content comparison.
+    std::filesystem::last_write_time("grid.inc", grid_mtime + std::chrono::seconds(10));
+    const auto deck4 = parser.parseFile("CASE.DATA");
+    BOOST_CHECK_EQUAL(poro_count(deck4), 1);
+    BOOST_CHECK(same_keywords(deck4, Opm::Parser{}.parseFile("CASE.DATA")));
+}
+
+BOOST_AUTO_TEST_CASE(DeckCacheWarnings) {
+    WorkArea work;
+    write_file("CASE.DATA", R"(
+RUNSPEC
+DIMENS
+  2 1 1 /
+GRID
+INCLUDE
+  'grid.inc' /
+SCHEDULE
+INCLUDE
+  'sched.inc' /
+)");
+    write_file("grid.inc", "PORO\n 2*0.25 /\nFOOBAR\n");
+    write_file("sched.inc", "TSTEP\n 10 /\n");
+
+    Opm::Parser parser;
+    parser.enableDeckCache("cache");
+
+    Opm::ParseContext parseContext;
+    parseContext.update(Opm::ParseContext::PARSE_UNKNOWN_KEYWORD, Opm::InputErrorAction::WARN);
+
+    Opm::ErrorGuard errors1;
+    parser.parseFile("CASE.DATA", parseContext, errors1);
+    BOOST_CHECK_EQUAL(errors1.warnings().size(), 1U);
+
+    // Full cache hit.
+    Opm::ErrorGuard errors2;
+    parser.parseFile("CASE.DATA", parseContext, errors2);
+    BOOST_CHECK(errors2.warnings() == errors1.warnings());
+
+    // Only the GRID include is restored from the cache.
+    write_file("sched.inc", "TSTEP\n 10 20 /\n");
+    Opm::ErrorGuard errors3;
+    parser.parseFile("CASE.DATA", parseContext, errors3);
+    BOOST_CHECK(errors3.warnings() == errors1.warnings());
+
+    // Lazy parsing reads images written by eager parsing, but does not
+    // write them itself.
+    Opm::Parser lazy_parser;
+    lazy_parser.setLazyParsing(true);
+    lazy_parser.enableDeckCache("lazy_cache");
+
+    Opm::ErrorGuard errors4;
+    lazy_parser.parseFile("CASE.DATA", parseContext, errors4);
+    BOOST_CHECK(!std::filesystem::exists("lazy_cache"));
+
+    const auto eager_hash = Opm::DeckCache::parserHash(parser, parseContext);
+    parser.setLazyParsing(true);
+    BOOST_CHECK_EQUAL(Opm::DeckCache::parserHash(parser, parseContext), eager_hash);
+
+    Opm::ErrorGuard errors5;
+    const auto deck = parser.parseFile("CASE.DATA", parseContext, errors5);
+    BOOST_CHECK(errors5.warnings() == errors1.warnings());
+    BOOST_CHECK_EQUAL(deck["TSTEP"].back().getRecord(0).getItem(0).data_size(), 2U);
+}
@@ -306,6 +306,23 @@ BOOST_AUTO_TEST_CASE(ReplaceKeyword) {
 }
 
 
+BOOST_AUTO_TEST_CASE(BuiltinKeywordsShared) {
+    const Parser parser1;
+    const Parser parser2;
+
+    BOOST_CHECK(parser1.hasKeyword("PORO"));
+    BOOST_CHECK_EQUAL(&parser1.getKeyword("PORO"), &parser2.getKeyword("PORO"));
+    BOOST_CHECK_EQUAL(parser1.size(), parser2.size());
+
+    Parser parser3;
+    const auto size = parser3.size();
+    parser3.addParserKeyword(createDynamicSized("PORO"));
+    BOOST_CHECK_EQUAL(parser3.size(), size);
+    BOOST_CHECK(&parser3.getKeyword("PORO") != &parser1.getKeyword("PORO"));
+    BOOST_CHECK(!parser3.getKeyword("PORO").isDataKeyword());
+}
+
+
 BOOST_AUTO_TEST_CASE(WildCardTest) {
     Parser parser;
     BOOST_CHECK(!parser.isRecognizedKeyword("TVDP*"));
@@ -1401,6 +1418,35 @@ BOOST_AUTO_TEST_CASE(ParserKeywordMatches) {
     BOOST_CHECK_EQUAL( false , parserKeyword.matches("WORLD#BC"));
 }
 
+BOOST_AUTO_TEST_CASE(ParserKeywordMatchPrefixes) {
+    auto parserKeyword = createFixedSized("HELLO", (size_t) 1);
+    parserKeyword.clearDeckNames();
+    parserKeyword.setMatchRegex("WORLD.+|AB?C.+|X+Y");
+    const std::vector<std::string> expected = {"A", "WORLD", "X"};
+    const auto prefixes = parserKeyword.matchPrefixes();
+    BOOST_CHECK_EQUAL_COLLECTIONS(prefixes.begin(), prefixes.end(), expected.begin(), expected.end());
+
+    parserKeyword.setMatchRegex("(R[OG]FT|RWFT).+");
+    const auto unrestricted = parserKeyword.matchPrefixes();
+    BOOST_CHECK_EQUAL(unrestricted.size(), 1U);
+    BOOST_CHECK_EQUAL(unrestricted.front(), "");
+
+    Parser parser(false);
+    parserKeyword.setMatchRegex("(AB|CD)E.+");
+    parser.addParserKeyword(parserKeyword);
+
+    auto world = createFixedSized("WORLD", (size_t) 1);
+    world.clearDeckNames();
+    world.setMatchRegex("WORLD.+");
+    parser.addParserKeyword(world);
+
+    BOOST_CHECK(parser.isRecognizedKeyword("CDEX"));
+    BOOST_CHECK(parser.isRecognizedKeyword("WORLDX"));
+    BOOST_CHECK(!parser.isRecognizedKeyword("WORLD"));
+    BOOST_CHECK(!parser.isRecognizedKeyword("XWORLD"));
+    BOOST_CHECK_EQUAL(parser.getParserKeywordFromDeckName("WORLDX").getName(), "WORLD");
+}
+
 BOOST_AUTO_TEST_CASE(AddDataKeyword_correctlyConfigured) {
     auto parserKeyword = createFixedSized("PORO", (size_t) 1);
     ParserItem item( "ACTNUM", INT);
@@ -2989,3 +3035,100 @@ END
 }
 
 BOOST_AUTO_TEST_SUITE_END() // Parse_ROCK
+
+BOOST_AUTO_TEST_CASE(LazyParsing)
+{
+    const auto input = std::string { R"(RUNSPEC
+DIMENS
+ 2 2 1 /
+TABDIMS
+ 1* 2 /
+GRID
+PORO
+ 4*0.25 /
+PROPS
+ROCK
+ 123.4 0.40E-05 /
+ 271.8 1.61E-05 /
+)" };
+
+    Parser parser;
+    const auto eager = parser.parseString(input);
+
+    parser.setLazyParsing(true);
+    const auto lazy = parser.parseString(input);
+
+    BOOST_CHECK_EQUAL(lazy.size(), eager.size());
+    BOOST_CHECK(!lazy["PORO"].back().isParsed());
+
+    // The size of ROCK is taken from TABDIMS, which is parsed on demand.
+    BOOST_CHECK(lazy["TABDIMS"].back().isParsed());
+    BOOST_CHECK_EQUAL(lazy["ROCK"].back().size(), 2U);
+
+    const auto& poro = lazy["PORO"].back();
+    BOOST_CHECK_EQUAL(poro.getSIDoubleData().size(), 4U);
+    BOOST_CHECK(poro.isParsed());
+
+    // Copies made before materialization share the parse result.
+    const auto copy = lazy;
+    BOOST_CHECK(!copy["DIMENS"].back().isParsed());
+    BOOST_CHECK(copy["DIMENS"].back() == eager["DIMENS"].back());
+
+    for (std::size_t index = 0; index < eager.size(); ++index)
+        BOOST_CHECK(lazy[index] == eager[index]);
+
+    // Errors surface when the keyword is accessed, not during the scan.
+    const auto invalid = std::string { R"(RUNSPEC
+DIMENS
+ 2 X 1 /
+)" };
+    const auto invalid_deck = parser.parseString(invalid);
+    BOOST_CHECK_THROW(invalid_deck["DIMENS"].back().size(), OpmInputError);
+    BOOST_CHECK_THROW(invalid_deck["DIMENS"].back().size(), OpmInputError);
+}
+
+BOOST_AUTO_TEST_CASE(LazyParsingDiagnostics)
+{
+    const auto input = std::string { R"(RUNSPEC
+DIMENS
+ 2 2 1 7 /
+)" };
+
+    ParseContext warn;
+    warn.update(ParseContext::PARSE_EXTRA_DATA, InputErrorAction::WARN);
+
+    Parser parser;
+    ErrorGuard eager_errors;
+    const auto eager = parser.parseString(input, warn, eager_errors);
+    BOOST_CHECK_EQUAL(eager_errors.warnings().size(), 1U);
+
+    // The diagnostics of a lazily parsed keyword go to the guard of the
+    // parse call, when the keyword is accessed.
+    parser.setLazyParsing(true);
+    ErrorGuard lazy_errors;
+    const auto lazy = parser.parseString(input, warn, lazy_errors);
+    BOOST_CHECK(lazy_errors.warnings().empty());
+
+    BOOST_CHECK(lazy["DIMENS"].back() == eager["DIMENS"].back());
+    BOOST_CHECK(lazy_errors.warnings() == eager_errors.warnings());
+    BOOST_CHECK(!lazy_errors);
+
+    // Delayed errors are recorded in the guard as well, rather than thrown.
+    ParseContext delay;
+    delay.update(ParseContext::PARSE_EXTRA_DATA, InputErrorAction::DELAYED_EXIT1);
+    {
+        ErrorGuard errors;
+        const auto deck = parser.parseString(input, delay, errors);
+        BOOST_CHECK_EQUAL(deck["DIMENS"].back().size(), 1U);
+        BOOST_CHECK(errors);
+        errors.clear();
+    }
+
+    // Once the guard is gone, the errors are thrown.
+    const auto deck = [&parser, &input, &delay]()
+    {
+        ErrorGuard errors;
+        return parser.parseString(input, delay, errors);
+    }();
+    BOOST_CHECK_THROW(deck["DIMENS"].back().size(), OpmInputError);
+}
@@ -55,6 +55,7 @@
 #include <opm/input/eclipse/Schedule/Network/Balance.hpp>
 #include <opm/input/eclipse/Schedule/OilVaporizationProperties.hpp>
 #include <opm/input/eclipse/Schedule/ScheduleGrid.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleStepIndex.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
 #include <opm/input/eclipse/Schedule/Well/PAvg.hpp>
@@ -517,6 +518,94 @@ BOOST_AUTO_TEST_CASE(CreateScheduleDeckWellsOrderedGRUPTREE) {
 }
 
 
+BOOST_AUTO_TEST_CASE(ScheduleStepIndexGRUPTREE) {
+    const auto& schedule = make_schedule( createDeckWithWellsOrderedGRUPTREE() );
+    const auto index = schedule.stepIndex(0);
+
+    BOOST_CHECK_EQUAL(index->numWells(), 4U);
+    const auto& well_names = schedule[0].well_order().names();
+    for (std::size_t w = 0; w < index->numWells(); ++w) {
+        BOOST_CHECK_EQUAL(index->well(w).name(), well_names[w]);
+        BOOST_CHECK_EQUAL(index->wellIndex(well_names[w]).value(), w);
+        BOOST_CHECK(index->findWellBySeqIndex(index->well(w).seqIndex()) == &index->well(w));
+    }
+    BOOST_CHECK(!index->wellIndex("NO_SUCH_WELL").has_value());
+    BOOST_CHECK(index->findWell("NO_SUCH_WELL") == nullptr);
+
+    BOOST_CHECK_EQUAL(index->numGroups(), schedule[0].group_order().names().size());
+    const auto cg1 = index->groupIndex("CG1");
+    BOOST_REQUIRE(cg1.has_value());
+    BOOST_CHECK_EQUAL(index->group(*cg1).name(), "CG1");
+    BOOST_CHECK(!index->groupIndex("NO_SUCH_GROUP").has_value());
+
+    const auto child_well_names = [&index](const std::string& group)
+    {
+        std::vector<std::string> names;
+        for (const auto* well : index->childWells(index->groupIndex(group).value()))
+            names.push_back(well->name());
+        return names;
+    };
+
+    const auto field_wells = child_well_names("FIELD");
+    const auto expected_field = std::vector<std::string> { "DW_0", "CW_1", "BW_2", "AW_3" };
+    BOOST_CHECK_EQUAL_COLLECTIONS(field_wells.begin(), field_wells.end(),
+                                  expected_field.begin(), expected_field.end());
+
+    const auto pg2_wells = child_well_names("PG2");
+    const auto expected_pg2 = std::vector<std::string> { "BW_2", "AW_3" };
+    BOOST_CHECK_EQUAL_COLLECTIONS(pg2_wells.begin(), pg2_wells.end(),
+                                  expected_pg2.begin(), expected_pg2.end());
+
+    // The index is reused until the report step changes.
+    BOOST_CHECK(schedule.stepIndex(0) == index);
+    BOOST_CHECK_THROW(schedule.stepIndex(schedule.size()), std::invalid_argument);
+
+    auto sched_state = schedule[0];
+    BOOST_CHECK(index->current(sched_state));
+    sched_state.wells.update(Well { index->well(0) });
+    BOOST_CHECK(!index->current(sched_state));
+    BOOST_CHECK(index->current(schedule[0]));
+
+    // Groups referring to wells or groups which do not exist are errors.
+    auto missing_well = schedule[0];
+    auto cg1_group = missing_well.groups.get("CG1");
+    cg1_group.addWell("NO_SUCH_WELL");
+    missing_well.groups.update(std::move(cg1_group));
+    BOOST_CHECK_THROW(ScheduleStepIndex { missing_well }, std::out_of_range);
+
+    auto missing_group = schedule[0];
+    auto pg1_group = missing_group.groups.get("PG1");
+    pg1_group.addGroup("NO_SUCH_GROUP");
+    missing_group.groups.update(std::move(pg1_group));
+    BOOST_CHECK_THROW(ScheduleStepIndex { missing_group }, std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(ScheduleStepIndexConnections) {
+    const auto& schedule = make_schedule( createDeckWithWellsAndCompletionData() );
+
+    for (std::size_t step = 0; step < schedule.size(); ++step) {
+        const auto index = schedule.stepIndex(step);
+        const auto wells = schedule.getWells(step);
+        BOOST_REQUIRE_EQUAL(index->numWells(), wells.size());
+
+        std::size_t offset = 0;
+        for (std::size_t w = 0; w < wells.size(); ++w) {
+            BOOST_CHECK_EQUAL(index->well(w).name(), wells[w].name());
+            BOOST_CHECK_EQUAL(index->connectionOffset(w), offset);
+            offset += wells[w].getConnections().size();
+        }
+        BOOST_CHECK_EQUAL(index->connectionOffset(wells.size()), offset);
+        BOOST_CHECK_EQUAL(index->numConnections(), offset);
+        BOOST_CHECK_EQUAL(index->numSegments(), 0U);
+    }
+
+    // Report step 2 leaves the wells of step 1 unchanged, while step 3
+    // adds connections to OP_1.
+    BOOST_CHECK(schedule.stepIndex(2) == schedule.stepIndex(1));
+    BOOST_CHECK(schedule.stepIndex(3) != schedule.stepIndex(2));
+    BOOST_CHECK(schedule.stepIndex(1) != schedule.stepIndex(0));
+}
+
 BOOST_AUTO_TEST_CASE(GroupTree2TEST) {
     const auto& schedule = make_schedule( createDeckWithWellsOrderedGRUPTREE() );
 
@@ -4128,6 +4217,20 @@ BOOST_AUTO_TEST_CASE(WellNames)
         BOOST_CHECK(wml0.empty());
     }
 
+    {
+        // Cached pattern matches are shared by copies, but must not
+        // survive adding a name.
+        NameOrder wo { "P1", "I1", "P2" };
+        const auto wo_copy = wo;
+
+        BOOST_CHECK(wo.match("P*") == std::vector<std::size_t>({0, 2}));
+
+        wo.add("P3");
+        BOOST_CHECK(wo.match("P*") == std::vector<std::size_t>({0, 2, 3}));
+        BOOST_CHECK(wo_copy.match("P*") == std::vector<std::size_t>({0, 2}));
+        BOOST_CHECK(wo.match("*1") == std::vector<std::size_t>({0, 1}));
+    }
+
     {
         NameOrder wo({"P3", "P2", "P1"});
         wo.add("W3");
@@ -6301,3 +6404,60 @@ DATES             -- 1
     schedule.clear_event(ScheduleEvents::TUNING_CHANGE, 1);
     BOOST_CHECK(!schedule[1].events().hasEvent(ScheduleEvents::TUNING_CHANGE));
 }
+
+BOOST_AUTO_TEST_CASE(SharedWellStorage) {
+    std::string input = R"(
+START             -- 0
+19 JUN 2007 /
+
+SOLUTION
+
+SCHEDULE
+
+WELSPECS
+)";
+    const std::size_t num_wells = 100;
+    for (std::size_t well = 0; well < num_wells; ++well)
+        input += fmt::format("'W{}' 'G1' {} {} 1* 'OIL' /\n", well, 1 + well % 10, 1 + well / 10);
+    input += R"(/
+
+TSTEP
+10 10 /
+
+WCONPROD
+'W7' 'OPEN' 'ORAT' 100 /
+/
+
+TSTEP
+10 10 /
+)";
+
+    const auto schedule = make_schedule(input);
+    const auto num_steps = schedule.size();
+
+    for (std::size_t step = 0; step < num_steps; ++step) {
+        const auto& wells = schedule[step].wells;
+        BOOST_CHECK_EQUAL(wells.size(), num_wells);
+        BOOST_CHECK_EQUAL(static_cast<std::size_t>(std::distance(wells.begin(), wells.end())), num_wells);
+        BOOST_CHECK_EQUAL(wells.keys().size(), num_wells);
+        BOOST_CHECK(wells.has("W42"));
+        BOOST_CHECK(!wells.has("W100"));
+    }
+
+    // Only the updated well is stored again.
+    BOOST_CHECK_EQUAL(num_steps, 5U);
+    BOOST_CHECK(schedule[1].wells.get_ptr("W7") != schedule[2].wells.get_ptr("W7"));
+    BOOST_CHECK(schedule[1].wells.get_ptr("W8") == schedule[2].wells.get_ptr("W8"));
+    BOOST_CHECK(schedule[2].wells.get_ptr("W8") == schedule[4].wells.get_ptr("W8"));
+    BOOST_CHECK(schedule[1].wells == schedule[0].wells);
+    BOOST_CHECK(!(schedule[2].wells == schedule[1].wells));
+
+    const auto usage = schedule.shallowMemoryUsage();
+    BOOST_CHECK_EQUAL(usage.at("ScheduleState"), num_steps * sizeof(ScheduleState));
+
+    // One copy of each well, plus the new copy of W7, and the shards of the
+    // two distinct well maps.
+    const auto& wells_bytes = usage.at("wells");
+    BOOST_CHECK_GE(wells_bytes, (num_wells + 1) * sizeof(Well));
+    BOOST_CHECK_LT(wells_bytes, 2 * num_wells * sizeof(Well));
+}
@@ -5,6 +5,9 @@
 #include <opm/common/utility/String.hpp>
 #include <opm/common/utility/shmatch.hpp>
 
+#include <string>
+#include <vector>
+
 using namespace Opm;
 
 BOOST_AUTO_TEST_CASE( uppercase_copy ) {
@@ -149,4 +152,21 @@ BOOST_AUTO_TEST_CASE(match_test) {
     BOOST_CHECK( !shmatch("NAME.*", "NAME") );
 }
 
-
+BOOST_AUTO_TEST_CASE(compiled_pattern) {
+    const std::vector<std::string> patterns {
+        "NAME", "NAME*", "*NAME", "*", "**", "N*E", "N*M*E", "*AM*", "NA*ME*X",
+        "NAME?ABC", "NAME[0-9][0-9]", "NAME.*", "A*A", "*A*A*", ""
+    };
+    const std::vector<std::string> symbols {
+        "NAME", "NAMEABC", "NONAMEABC", "NAMEXABC", "NAME13", "NAME.EXT",
+        "NE", "NAME_X", "AA", "A", "ABA", "AAA", ""
+    };
+
+    for (const auto& pattern : patterns) {
+        const auto compiled = ShellPattern { pattern };
+        for (const auto& symbol : symbols) {
+            BOOST_CHECK_MESSAGE( compiled.match(symbol) == shmatch(pattern, symbol),
+                                 "Pattern '" << pattern << "' on '" << symbol << "'" );
+        }
+    }
+}
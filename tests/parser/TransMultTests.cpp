@@ -27,6 +27,8 @@
 
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FaceDir.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/Fault.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/FaultFace.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/GridDims.hpp>
 #include <opm/input/eclipse/EclipseState/Runspec.hpp>
@@ -90,6 +92,37 @@ MULTZ
     BOOST_CHECK_EQUAL( transMult.getMultiplier(0,0,0 , Opm::FaceDir::ZPlus) , 4.0 );
 }
 
+BOOST_AUTO_TEST_CASE(FaultMultipliers)
+{
+    Opm::EclipseGrid grid(5,5,5);
+    Opm::FieldPropsManager fp(Opm::Deck(), Opm::Phases{true, true, true}, grid, Opm::TableManager());
+    Opm::TransMult transMult(grid ,{} , fp);
+
+    BOOST_CHECK( transMult.getMultipliers(Opm::FaceDir::XPlus) == nullptr );
+
+    Opm::Fault fault("F1");
+    fault.addFace( Opm::FaultFace( 5,5,5, 1, 1, 0, 4, 0, 0, Opm::FaceDir::XPlus ) );
+    fault.addFace( Opm::FaultFace( 5,5,5, 1, 1, 0, 0, 1, 1, Opm::FaceDir::XPlus ) );
+    fault.setTransMult(0.5);
+    transMult.applyMULTFLT(fault);
+
+    // Schedule MULTFLT updates only touch the fault faces.
+    fault.setTransMult(0.1);
+    transMult.applyMULTFLT(fault);
+
+    const auto* multx = transMult.getMultipliers(Opm::FaceDir::XPlus);
+    BOOST_REQUIRE( multx != nullptr );
+    BOOST_CHECK_EQUAL( multx->size() , 125U );
+    BOOST_CHECK( transMult.getMultipliers(Opm::FaceDir::YPlus) == nullptr );
+
+    for (std::size_t g = 0; g < multx->size(); ++g) {
+        const auto i = g % 5, j = (g / 5) % 5, k = g / 25;
+        const auto on_fault = (i == 1) && ((k == 0) || ((k == 1) && (j == 0)));
+        BOOST_CHECK_CLOSE( (*multx)[g] , on_fault ? 0.05 : 1.0 , 1.0e-8 );
+        BOOST_CHECK_EQUAL( (*multx)[g] , transMult.getMultiplier(g, Opm::FaceDir::XPlus) );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Basic_Operations
 
 // ---------------------------------------------------------------------------
@@ -38,12 +38,14 @@
 #include <opm/input/eclipse/Schedule/ScheduleState.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQActive.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQAssign.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 #include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
@@ -70,6 +72,8 @@
 #include <utility>
 #include <vector>
 
+#include <fmt/format.h>
+
 using namespace Opm;
 
 namespace {
@@ -517,6 +521,107 @@ BOOST_AUTO_TEST_CASE(UDQ_DEFINETEST) {
         BOOST_CHECK_EQUAL( res["I1"].get(), 2 );
         BOOST_CHECK_EQUAL( res["I2"].get(), 1 );
     }
+    {
+        // Pattern selected wells interleaved with other wells, negated
+        // binary expression mixing a scalar and a well set.
+        UDQDefine def(udqp, "WUBHP",0, location, {"-", "(", "WBHP", "'P*'", "-", "2", "*", "WBHP", ")"});
+        SummaryState st(TimeService::now(), udqp.undefinedValue());
+        UDQState udq_state(udqp.undefinedValue());
+        WellMatcher wm(NameOrder({"P1", "I1", "P2", "I2"}));
+        UDQContext context(udqft, wm, {}, UDQContext::MatcherFactories{}, st, udq_state);
+        st.update_well_var("P1", "WBHP", 1);
+        st.update_well_var("I1", "WBHP", 10);
+        st.update_well_var("P2", "WBHP", 2);
+        st.update_well_var("I2", "WBHP", 20);
+
+        auto res = def.eval(context);
+        BOOST_CHECK_EQUAL(res.size(), 4U);
+        BOOST_CHECK_EQUAL( res["P1"].get(), 1 );
+        BOOST_CHECK_EQUAL( res["P2"].get(), 2 );
+        BOOST_CHECK_EQUAL( res["I1"].defined(), false);
+        BOOST_CHECK_EQUAL( res["I2"].defined(), false);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(UDQ_PROGRAM) {
+    UDQParams udqp;
+    UDQFunctionTable udqft(udqp);
+    SummaryState st(TimeService::now(), udqp.undefinedValue());
+    UDQState udq_state(udqp.undefinedValue());
+    WellMatcher wm(NameOrder({"P1", "I1", "P2", "I2"}));
+    UDQContext context(udqft, wm, {}, UDQContext::MatcherFactories{}, st, udq_state);
+
+    st.update_well_var("P1", "WBHP", 1);
+    st.update_well_var("I1", "WBHP", 10);
+    st.update_well_var("P2", "WBHP", 2);
+    st.update_well_var("I2", "WBHP", 20);
+    st.update_well_var("P1", "WOPR", 0);
+    st.update_well_var("P2", "WOPR", 4);
+    st.update_group_var("G1", "GOPR", 5);
+    st.update("FOPR", 4);
+    st.update("FWPR", 0);
+
+    const auto expr = [](const std::string& key, const std::vector<std::string>& selector = {})
+    {
+        return UDQASTNode { UDQTokenType::ecl_expr, key, selector };
+    };
+
+    const auto binary = [](UDQTokenType type, const std::string& op,
+                           const UDQASTNode& left, const UDQASTNode& right)
+    {
+        return UDQASTNode { type, op, left, right };
+    };
+
+    // The compiled program must reproduce the expression tree element by
+    // element, including undefined values.
+    const auto check_same = [&context](const UDQASTNode& ast)
+    {
+        const auto program = UDQProgram::compile(ast, UDQVarType::WELL_VAR);
+        BOOST_REQUIRE(program.has_value());
+
+        const auto compiled = program->eval("WUX", context);
+        BOOST_REQUIRE(compiled.has_value());
+
+        auto expected = ast.eval(UDQVarType::WELL_VAR, context);
+        expected.name("WUX");
+        BOOST_CHECK(*compiled == expected);
+    };
+
+    // -(WBHP 'P*' - 2*WBHP)
+    check_same(-1.0 * binary(UDQTokenType::binary_op_sub, "-", expr("WBHP", {"P*"}),
+                             binary(UDQTokenType::binary_op_mul, "*", UDQASTNode(2.0), expr("WBHP"))));
+
+    // WBHP / WOPR + FOPR: division by zero and missing values are undefined.
+    check_same(binary(UDQTokenType::binary_op_add, "+",
+                      binary(UDQTokenType::binary_op_div, "/", expr("WBHP"), expr("WOPR")),
+                      expr("FOPR")));
+
+    // WBHP 'P2' * WBHP / FWPR
+    check_same(binary(UDQTokenType::binary_op_div, "/",
+                      binary(UDQTokenType::binary_op_mul, "*", expr("WBHP", {"P2"}), expr("WBHP")),
+                      expr("FWPR")));
+
+    // GOPR * (WBHP 'I2' - FOPR)
+    {
+        const auto ast = binary(UDQTokenType::binary_op_mul, "*", expr("GOPR"),
+                                binary(UDQTokenType::binary_op_sub, "-",
+                                       expr("WBHP", {"I2"}), expr("FOPR")));
+
+        const auto program = UDQProgram::compile(ast, UDQVarType::GROUP_VAR);
+        BOOST_REQUIRE(program.has_value());
+
+        const auto compiled = program->eval("GUX", context);
+        BOOST_REQUIRE(compiled.has_value());
+
+        auto expected = ast.eval(UDQVarType::GROUP_VAR, context);
+        expected.name("GUX");
+        BOOST_CHECK(*compiled == expected);
+        BOOST_CHECK_EQUAL((*compiled)["G1"].get(), 80.0);
+    }
+
+    // Functions are not compiled.
+    const auto abs = UDQASTNode { UDQTokenType::elemental_func_abs, "ABS", expr("WBHP") };
+    BOOST_CHECK(!UDQProgram::compile(abs, UDQVarType::WELL_VAR).has_value());
 }
 
 BOOST_AUTO_TEST_CASE(KEYWORDS) {
@@ -2105,6 +2210,83 @@ DEFINE FU_PAR2 FU_PAR3 /
     BOOST_CHECK_EQUAL(st.get("FU_PAR2"), 100);
 }
 
+BOOST_AUTO_TEST_CASE(UDQ_DEFINE_LEVELS) {
+    std::string deck_string = R"(
+SCHEDULE
+UDQ
+DEFINE FU_A FOPR + 1 /
+DEFINE FU_B FU_C * 2 /
+DEFINE FU_C FU_A + 1 /
+DEFINE FU_D FOPR * 2 /
+DEFINE FU_E FU_C + FU_D /
+/
+)";
+    auto schedule = make_schedule(deck_string);
+    const auto& udq = schedule.getUDQConfig(0);
+    const auto undefined_value =  udq.params().undefinedValue();
+    SummaryState st(TimeService::now(), undefined_value);
+    UDQState udq_state(undefined_value);
+    auto segmentMatcherFactory = []() { return std::make_unique<SegmentMatcher>(ScheduleState {}); };
+    auto regionSetMatcherFactory = []() { return std::make_unique<RegionSetMatcher>(FIPRegionStatistics {}); };
+
+    st.update("FOPR", 10);
+    udq.eval(0, schedule, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+
+    BOOST_CHECK_EQUAL(st.get("FU_A"), 11);
+    BOOST_CHECK_EQUAL(st.get("FU_B"), undefined_value);  // FU_C not yet evaluated
+    BOOST_CHECK_EQUAL(st.get("FU_C"), 12);
+    BOOST_CHECK_EQUAL(st.get("FU_D"), 20);
+    BOOST_CHECK_EQUAL(st.get("FU_E"), 32);
+
+    // FU_B must see the value of FU_C from the previous evaluation.
+    st.update("FOPR", 20);
+    udq.eval(0, schedule, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+
+    BOOST_CHECK_EQUAL(st.get("FU_A"), 21);
+    BOOST_CHECK_EQUAL(st.get("FU_B"), 24);
+    BOOST_CHECK_EQUAL(st.get("FU_C"), 22);
+    BOOST_CHECK_EQUAL(st.get("FU_D"), 40);
+    BOOST_CHECK_EQUAL(st.get("FU_E"), 62);
+}
+
+BOOST_AUTO_TEST_CASE(UDQ_DEFINE_LEVELS_CONCURRENT) {
+    // Enough independent statements on the first level to be evaluated
+    // concurrently, and one statement on the second level reading all of
+    // them.
+    const auto num_defines = 32;
+
+    auto deck_string = std::string { "SCHEDULE\nUDQ\n" };
+    auto sum = std::string{};
+    for (auto i = 1; i <= num_defines; ++i) {
+        deck_string += fmt::format("DEFINE FU_X{0} FOPR * {0} /\n", i);
+        sum += fmt::format("{}FU_X{}", (i == 1) ? "" : " + ", i);
+    }
+    deck_string += fmt::format("DEFINE FU_SUM {} /\n/\n", sum);
+
+    auto schedule = make_schedule(deck_string);
+    const auto& udq = schedule.getUDQConfig(0);
+    const auto undefined_value =  udq.params().undefinedValue();
+    SummaryState st(TimeService::now(), undefined_value);
+    UDQState udq_state(undefined_value);
+    auto segmentMatcherFactory = []() { return std::make_unique<SegmentMatcher>(ScheduleState {}); };
+    auto regionSetMatcherFactory = []() { return std::make_unique<RegionSetMatcher>(FIPRegionStatistics {}); };
+
+    for (auto step = 1; step <= 3; ++step) {
+        st.update("FOPR", 10.0 * step);
+        udq.eval(0, schedule, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+
+        auto expected_sum = 0.0;
+        for (auto i = 1; i <= num_defines; ++i) {
+            const auto expected = 10.0 * step * i;
+            BOOST_CHECK_EQUAL(st.get(fmt::format("FU_X{}", i)), expected);
+            BOOST_CHECK_EQUAL(udq_state.get(fmt::format("FU_X{}", i)), expected);
+            expected_sum += expected;
+        }
+
+        BOOST_CHECK_EQUAL(st.get("FU_SUM"), expected_sum);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(UDQ_UNDEFINED2) {
     std::string deck_string = R"(
 SCHEDULE
@@ -2935,6 +3117,114 @@ BOOST_AUTO_TEST_CASE(UDQ_Update_SummaryState)
     BOOST_CHECK_CLOSE(st.get_group_var("G1", "GUNDA_ST"),  652.44, 1.0e-8);
 }
 
+BOOST_AUTO_TEST_CASE(SummaryState_Change_Stamps)
+{
+    auto st = SummaryState { TimeService::now(), 0.0 };
+
+    const auto initial = st.change_stamp("FOPR");
+    BOOST_CHECK_EQUAL(st.change_stamp("WOPR"), initial);
+
+    st.update("FOPR", 1.0);
+    const auto fopr = st.change_stamp("FOPR");
+    BOOST_CHECK_GT(fopr, initial);
+
+    // Assigning the same value is not a change.
+    st.update("FOPR", 1.0);
+    BOOST_CHECK_EQUAL(st.change_stamp("FOPR"), fopr);
+
+    // Neither is adding zero to a total.
+    st.update("FOPT", 10.0);
+    const auto fopt = st.change_stamp("FOPT");
+    st.update("FOPT", 0.0);
+    BOOST_CHECK_EQUAL(st.change_stamp("FOPT"), fopt);
+    st.update("FOPT", 1.0);
+    BOOST_CHECK_GT(st.change_stamp("FOPT"), fopt);
+
+    // New wells, even with a zero value, change the vector and the names.
+    st.update_well_var("P1", "WOPR", 0.0);
+    const auto wopr = st.change_stamp("WOPR");
+    const auto names = st.names_change_stamp();
+    BOOST_CHECK_GT(wopr, fopr);
+
+    st.update_well_var("P1", "WOPR", 0.0);
+    BOOST_CHECK_EQUAL(st.change_stamp("WOPR"), wopr);
+
+    st.update_well_var("P1", "WWCT", 0.5);
+    BOOST_CHECK_EQUAL(st.change_stamp("WOPR"), wopr);
+    BOOST_CHECK_EQUAL(st.names_change_stamp(), names);
+
+    st.update_well_var("P2", "WWCT", 0.5);
+    BOOST_CHECK_GT(st.names_change_stamp(), names);
+
+    // A copy may diverge from the original, so all of its stamps are new.
+    const auto copy = st;
+    BOOST_CHECK_GT(copy.change_stamp("FOPR"), st.change_stamp("WWCT"));
+    BOOST_CHECK_GT(copy.change_stamp("WOPR"), st.change_stamp("WWCT"));
+}
+
+BOOST_AUTO_TEST_CASE(UDQ_DEFINE_UNCHANGED_INPUTS)
+{
+    std::string deck_string = R"(
+SCHEDULE
+UDQ
+DEFINE FU_A FOPR * 2 /
+DEFINE FU_B FWPR + 1 /
+DEFINE FU_C FU_A + FU_B /
+/
+)";
+    auto schedule = make_schedule(deck_string);
+    const auto& udq = schedule.getUDQConfig(0);
+    const auto undefined_value =  udq.params().undefinedValue();
+    SummaryState st(TimeService::now(), undefined_value);
+    UDQState udq_state(undefined_value);
+    auto segmentMatcherFactory = []() { return std::make_unique<SegmentMatcher>(ScheduleState {}); };
+    auto regionSetMatcherFactory = []() { return std::make_unique<RegionSetMatcher>(FIPRegionStatistics {}); };
+
+    st.update("FOPR", 1.0);
+    st.update("FWPR", 1.0);
+    udq.eval(0, schedule, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(st.get("FU_A"), 2.0);
+    BOOST_CHECK_EQUAL(st.get("FU_B"), 2.0);
+    BOOST_CHECK_EQUAL(st.get("FU_C"), 4.0);
+
+    // Overwrite the published summary values.  Statements which are
+    // evaluated again restore them.
+    const auto mark = [&st]()
+    {
+        for (const auto* udq_key : { "FU_A", "FU_B", "FU_C" }) {
+            st.update(udq_key, -1.0);
+        }
+    };
+
+    // No input changed: nothing is evaluated.
+    mark();
+    st.update("FOPR", 1.0);
+    udq.eval(0, schedule, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(st.get("FU_A"), -1.0);
+    BOOST_CHECK_EQUAL(st.get("FU_B"), -1.0);
+    BOOST_CHECK_EQUAL(st.get("FU_C"), -1.0);
+
+    // FOPR changed: FU_A and, through FU_A, FU_C are evaluated.
+    st.update("FOPR", 2.0);
+    udq.eval(0, schedule, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(st.get("FU_A"), 4.0);
+    BOOST_CHECK_EQUAL(st.get("FU_B"), -1.0);
+    BOOST_CHECK_EQUAL(st.get("FU_C"), 6.0);
+
+    // Assigning a UDQ outside of the DEFINE statement is a change.
+    udq_state.add_assign("FU_B", UDQSet::scalar("FU_B", 10.0));
+    udq.eval(0, schedule, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(st.get("FU_B"), 2.0);
+    BOOST_CHECK_EQUAL(st.get("FU_C"), 6.0);
+
+    // All statements are evaluated in a new report step.
+    mark();
+    udq.eval(1, schedule, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(st.get("FU_A"), 4.0);
+    BOOST_CHECK_EQUAL(st.get("FU_B"), 2.0);
+    BOOST_CHECK_EQUAL(st.get("FU_C"), 6.0);
+}
+
 BOOST_AUTO_TEST_CASE(UDQ_WITH_UDT_FIELD)
 {
     std::string valid = R"(
@@ -28,6 +28,10 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <fmt/format.h>
+
+#include <string>
+
 using namespace Opm;
 
 
@@ -430,6 +434,37 @@ BOOST_AUTO_TEST_CASE(readDeck_EDITR)
     check_nnc(editr, grid.getGlobalIndex(2,0,0), grid.getGlobalIndex(7,0,0), 2.0);
 }
 
+BOOST_AUTO_TEST_CASE(readDeck_ORDER)
+{
+    // Enough records, in descending cell order, that the sort is not a
+    // plain insertion sort.  Every cell pair appears in three rounds with
+    // increasing transmissibility.
+    std::string input = "GRID\nNNC\n";
+    for (int round = 1; round <= 3; ++round) {
+        for (int j = 10; j >= 1; --j) {
+            for (int i = 10; i >= 3; --i)
+                input += fmt::format("{} {} 1 1 1 1 {} /\n", i, j, round);
+        }
+    }
+    input += "/\n";
+
+    Parser parser;
+    auto deck = parser.parseString(input);
+    EclipseGrid grid(10,10,1);
+
+    NNC nnc(grid, deck);
+    const auto& data = nnc.input();
+    check_order(data);
+    BOOST_REQUIRE_EQUAL(data.size(), 3U * 80U);
+
+    // NNCs between the same cell pair are kept in the order of the deck.
+    for (std::size_t index = 0; index < data.size(); index += 3) {
+        BOOST_CHECK_CLOSE(data[index + 0].trans, 1.0*Opm::Metric::Transmissibility, 1.0e-8);
+        BOOST_CHECK_CLOSE(data[index + 1].trans, 2.0*Opm::Metric::Transmissibility, 1.0e-8);
+        BOOST_CHECK_CLOSE(data[index + 2].trans, 3.0*Opm::Metric::Transmissibility, 1.0e-8);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(ACTNUM)
 {
     Parser parser;
@@ -447,3 +482,26 @@ BOOST_AUTO_TEST_CASE(ACTNUM)
 }
 
 
+
+BOOST_AUTO_TEST_CASE(BulkMerge)
+{
+    NNC nnc;
+    nnc.addNNC(2, 7, 1.0);
+    nnc.addNNC(9, 3, 2.0);
+    nnc.addNNC(1, 4, 3.0);
+    nnc.addNNC(7, 2, 4.0);
+
+    nnc.merge({ {8, 1, 5.0}, {2, 7, 6.0}, {5, 6, 7.0}, {0, 9, 8.0} });
+    nnc.merge({});
+
+    const auto& input = nnc.input();
+    check_order(input);
+    BOOST_REQUIRE_EQUAL(input.size(), 8);
+
+    // NNCs between the same cell pair are kept in insertion order.
+    const std::vector<NNCdata> expected {
+        {0, 9, 8.0}, {1, 4, 3.0}, {1, 8, 5.0}, {2, 7, 1.0},
+        {2, 7, 4.0}, {2, 7, 6.0}, {3, 9, 2.0}, {5, 6, 7.0},
+    };
+    BOOST_CHECK(input == expected);
+}
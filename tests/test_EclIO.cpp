@@ -336,6 +336,51 @@ BOOST_AUTO_TEST_CASE(TestEcl_Write_formatted) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestEcl_Write_generated) {
+    // Streaming output must be identical to writing the full vectors, also
+    // for arrays spanning several generator blocks.
+    const std::size_t size = 150'001;
+
+    std::vector<int> inte(size);
+    std::vector<float> real(size);
+    std::vector<double> doub(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        inte[i] = static_cast<int>(i) - 5;
+        real[i] = 0.25f * i;
+        doub[i] = 1.0e-3 * i;
+    }
+
+    auto from = [](const auto& source)
+    {
+        using T = typename std::decay_t<decltype(source)>::value_type;
+        return [&source](const std::size_t offset, std::vector<T>& block)
+        {
+            std::copy_n(source.begin() + offset, block.size(), block.begin());
+        };
+    };
+
+    WorkArea work;
+    for (const bool formatted : { false, true }) {
+        {
+            EclOutput eclTest("TEST_VECTOR.DAT", formatted);
+            eclTest.write("INTE", inte);
+            eclTest.write("REAL", real);
+            eclTest.write("DOUB", doub);
+            eclTest.write("EMPTY", std::vector<float>{});
+        }
+        {
+            EclOutput eclTest("TEST_GENERATED.DAT", formatted);
+            eclTest.write<int>("INTE", size, from(inte));
+            eclTest.write<float>("REAL", size, from(real));
+            eclTest.write<double>("DOUB", size, from(doub));
+            eclTest.write<float>("EMPTY", 0, from(real));
+        }
+
+        BOOST_CHECK_MESSAGE(compare_files("TEST_VECTOR.DAT", "TEST_GENERATED.DAT"),
+                            "Generated output differs, formatted = " << formatted);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(TestEcl_Write_formatted_not_finite) {
     WorkArea wa;
     std::vector<float>  float_vector{std::numeric_limits<float>::infinity()  , std::numeric_limits<float>::quiet_NaN()};